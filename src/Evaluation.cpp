@@ -0,0 +1,114 @@
+#include "Evaluation.h"
+
+#include <algorithm>
+
+/**
+ * @brief State of the depth-first search of articulation points, indexed by the id of the piece on top of the space.
+ */
+struct articulationSearch {
+	const HiveBoard& gameMap;                        /**< The game board. */
+	std::array<std::int8_t, PIECES_COUNT> discovery; /**< Order of discovery of the space, 0 for unvisited. */
+	std::array<std::int8_t, PIECES_COUNT> lowLink;   /**< Lowest discovery reachable through one back edge. */
+	std::int8_t time = 0;                            /**< Discovery order of the last visited space. */
+	piecesMask articulationPoints = 0;               /**< Pieces on top of articulation points found so far. */
+
+	/**
+	 * @brief Visits the space and all unvisited spaces reachable from it (Tarjan's algorithm).
+	 *
+	 * @param piece The id of the piece on top of the space.
+	 * @param parent The id of the piece on top of the space from which the space was entered, NO_PIECE for root.
+	 */
+	void Visit(pieceId piece, pieceId parent) {
+		discovery[piece] = lowLink[piece] = ++time;
+		int childrenCount = 0;
+		const auto& cords = gameMap.GetPositionOfPiece(piece);
+		ForEachNeighborInMask(cords, gameMap.GetOccupiedNeighborsMask(cords), [&](const HexCords& neighbor) {
+			auto neighborPiece = gameMap.GetPieceAt(neighbor);
+			if (discovery[neighborPiece] == 0) {
+				childrenCount++;
+				Visit(neighborPiece, piece);
+				lowLink[piece] = std::min(lowLink[piece], lowLink[neighborPiece]);
+				if (parent != NO_PIECE && lowLink[neighborPiece] >= discovery[piece]) {
+					articulationPoints |= (piecesMask)1 << piece;
+				}
+			} else if (neighborPiece != parent) {
+				lowLink[piece] = std::min(lowLink[piece], discovery[neighborPiece]);
+			}
+		});
+		if (parent == NO_PIECE && childrenCount > 1) {
+			articulationPoints |= (piecesMask)1 << piece;
+		}
+	}
+};
+
+int Evaluate(const HiveBoard& gameMap, int IDOfPlayer) {
+	auto pinnedPieces = GetPinnedPieces(gameMap);
+	int borderSize = gameMap.GetBorderOfHive().Count();
+
+	std::array<int, 2> scores = { 0, 0 };
+	for (int player = 0; player < 2; player++) {
+		auto queen = MakePieceId(player, 0, 0);
+		if (gameMap.IsPieceOnBoard(queen)) {
+			const auto& queenCords = gameMap.GetPositionOfPiece(queen);
+			scores[player] -= QUEEN_NEIGHBORS_PENALTY[gameMap.GetOccupiedNeighborsCount(queenCords)];
+		}
+		scores[player] += EvaluateHand(gameMap.GetPlayerAvaiblepieces(player));
+
+		for (int i = 0; i < PIECES_PER_PLAYER; i++) {
+			auto piece = (pieceId)(player * PIECES_PER_PLAYER + i);
+			if (!gameMap.IsPieceOnBoard(piece)) {
+				continue;
+			}
+			auto type = (int)GetBugTypeOfPiece(piece);
+			if ((pinnedPieces >> piece) & 1) {
+				scores[player] -= PINNED_PENALTY[type];
+			} else {
+				scores[player] += MOBILITY_WEIGHTS[type] * EstimateMobility(gameMap, piece, borderSize);
+			}
+		}
+	}
+	return scores[IDOfPlayer] - scores[(IDOfPlayer + 1) % 2];
+}
+
+piecesMask GetPinnedPieces(const HiveBoard& gameMap) {
+	articulationSearch search = { gameMap, {}, {}, 0, 0 };
+	piecesMask stackedPieces = 0;
+	piecesMask coveredPieces = 0;
+	for (int piece = 0; piece < PIECES_COUNT; piece++) {
+		if (gameMap.IsPieceOnBoard((pieceId)piece) && gameMap.GetPieceUnder((pieceId)piece) != NO_PIECE) {
+			stackedPieces |= (piecesMask)1 << piece;
+			coveredPieces |= (piecesMask)1 << gameMap.GetPieceUnder((pieceId)piece);
+		}
+	}
+
+	// Hive is connected, so one search from any space visits all of them
+	for (int piece = 0; piece < PIECES_COUNT; piece++) {
+		if (gameMap.IsPieceOnBoard((pieceId)piece)) {
+			search.Visit(gameMap.GetPieceAt(gameMap.GetPositionOfPiece((pieceId)piece)), NO_PIECE);
+			break;
+		}
+	}
+
+	// Piece on top of the stack can always leave it, the pieces under it are pinned instead
+	return (search.articulationPoints & ~stackedPieces) | coveredPieces;
+}
+
+int EstimateMobility(const HiveBoard& gameMap, pieceId piece, int borderSize) {
+	const auto& cords = gameMap.GetPositionOfPiece(piece);
+	int occupiedNeighbors = gameMap.GetOccupiedNeighborsCount(cords);
+	bool hasFreedomToMove = occupiedNeighbors <= 4;
+
+	switch (GetBugTypeOfPiece(piece)) {
+		case bugType::QUEEN_BEE:
+		case bugType::SPIDER:
+			return hasFreedomToMove ? HEXAGON_SIDES_COUNT - occupiedNeighbors : 0;
+		case bugType::SOLDIER_ANT:
+			return hasFreedomToMove ? borderSize : 0;
+		case bugType::BEETLE:
+			return HEXAGON_SIDES_COUNT;
+		case bugType::GRASS_HOPPER:
+			// One jump over every occupied neighbor
+			return occupiedNeighbors;
+	}
+	return 0;
+}
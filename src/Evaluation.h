@@ -0,0 +1,84 @@
+/**
+ * @file Evaluation.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the static evaluation of positions used by the search
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+#include "HiveBoard.h"
+#include "bugTiles.h"
+#include "common.h"
+
+#include <array>
+#include <cstdint>
+
+using piecesMask = std::uint32_t; /**< Set of pieces, bit i is set for piece with id i. */
+
+// Weights of the evaluation, arrays over bug types are indexed by bugType
+
+/**
+ * @brief Penalty of the Queen by the number of its occupied neighbors, it grows faster as the Queen gets surrounded.
+ */
+constexpr std::array<int, HEXAGON_SIDES_COUNT + 1> QUEEN_NEIGHBORS_PENALTY = { 0, 8, 20, 40, 75, 130, 0 };
+
+constexpr std::array<int, DIFFERENT_PIECES_COUNT> MOBILITY_WEIGHTS = { 4, 2, 1, 2, 2 }; /**< Score of one move. */
+constexpr std::array<int, DIFFERENT_PIECES_COUNT> PINNED_PENALTY = { 15, 8, 12, 6, 6 }; /**< Penalty of pinned piece. */
+constexpr std::array<int, DIFFERENT_PIECES_COUNT> HAND_VALUE = { 0, 3, 4, 2, 2 };       /**< Score of piece in hand. */
+
+/**
+ * @brief Evaluates the position.
+ *
+ * Sums Queen liberties, pinned pieces, estimated mobility and pieces in hand of both players. Queen liberties and
+ * pieces in hand are read from counters kept by the board, pinned pieces are found by one pass of articulation point
+ * search and mobility is estimated from neighbor masks and popcount of the border of the hive, so no moves are
+ * generated. Pinned pieces and mobility are recomputed for every position, HiveBench compares their cost with the
+ * generation of all moves.
+ *
+ * @param gameMap The game board.
+ * @param IDOfPlayer The ID of the player on turn.
+ * @return Score of the position from the view of the player on turn.
+ */
+int Evaluate(const HiveBoard& gameMap, int IDOfPlayer);
+
+/**
+ * @brief Evaluates pieces in hand of one player.
+ *
+ * @param avaiblePieces Pieces in hand, see Player::GetPlayerAvaiblepieces and HiveBoard::GetPlayerAvaiblepieces.
+ * @return Score of the pieces.
+ */
+constexpr int EvaluateHand(const std::array<playerPiece, DIFFERENT_PIECES_COUNT>& avaiblePieces) {
+	int score = 0;
+	for (const auto& piece : avaiblePieces) {
+		score += HAND_VALUE[(int)piece.first] * piece.second;
+	}
+	return score;
+}
+
+/**
+ * @brief Get the pieces, that can't move without breaking the hive or because something lies on top of them.
+ *
+ * Pieces lying on the ground are pinned if their space is articulation point of the hive. Pieces on top of stacks are
+ * never pinned.
+ *
+ * @param gameMap The game board.
+ * @return Mask of pinned pieces.
+ */
+piecesMask GetPinnedPieces(const HiveBoard& gameMap);
+
+/**
+ * @brief Estimates the number of moves of the piece without generating them.
+ *
+ * @param gameMap The game board.
+ * @param piece The id of the piece lying on top of its space, that isn't pinned.
+ * @param borderSize Number of spaces on the border of the hive.
+ * @return Estimated number of moves.
+ */
+int EstimateMobility(const HiveBoard& gameMap, pieceId piece, int borderSize);
+
+#endif  // !EVALUATION_H
@@ -0,0 +1,145 @@
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+FrameProfiler FrameProfiler::defaultProfiler;
+
+bool FrameProfiler::CheckInputs() {
+	if (IsKeyPressed(KEY_F4)) {
+		ExportCsv(FRAME_PROFILE_FILE);
+		std::cout << "Frame profile exported to " << FRAME_PROFILE_FILE << std::endl;
+	}
+	if (IsKeyPressed(KEY_F3)) {
+		SetEnabled(!isEnabled);
+		return true;
+	}
+	return false;
+}
+
+void FrameProfiler::SetEnabled(bool enabled) {
+	isEnabled = enabled;
+	// Limit of FPS would be measured as the time of EndDrawing
+	SetTargetFPS(isEnabled ? 0 : FPS);
+}
+
+void FrameProfiler::BeginFrame() {
+	framesCount++;
+	if (!isEnabled) {
+		return;
+	}
+	currentFrame = frameSample();
+	currentFrame.frameNumber = framesCount;
+	currentFrame.startTime = GetTime();
+	frameStart = std::chrono::steady_clock::now();
+}
+
+void FrameProfiler::EndFrame() {
+	if (!isEnabled || currentFrame.frameNumber != framesCount) {
+		return;
+	}
+	currentFrame.times[TOTAL_COLUMN] =
+	    std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+	history[nextSampleIndex] = currentFrame;
+	nextSampleIndex = (nextSampleIndex + 1) % HISTORY_SIZE;
+	samplesCount = std::min(samplesCount + 1, HISTORY_SIZE);
+
+	if (currentFrame.times[TOTAL_COLUMN] > BUDGET_MS) {
+		PrintSlowFrame(currentFrame);
+	}
+}
+
+float FrameProfiler::GetPercentile(int column, float percentile) const {
+	if (samplesCount == 0) {
+		return 0;
+	}
+	std::vector<float> times(samplesCount);
+	for (std::size_t i = 0; i < samplesCount; i++) {
+		times[i] = GetSample(i).times[column];
+	}
+	auto percentileIterator = times.begin() + (std::ptrdiff_t)((float)(samplesCount - 1) * percentile);
+	std::nth_element(times.begin(), percentileIterator, times.end());
+	return *percentileIterator;
+}
+
+void FrameProfiler::PrintSlowFrame(const frameSample& sample) const {
+	std::cout << TextFormat("Frame %llu at %.3f s took %.2f ms, budget is %.2f ms",
+	                        (unsigned long long)sample.frameNumber, sample.startTime, sample.times[TOTAL_COLUMN],
+	                        BUDGET_MS)
+	          << std::endl;
+	for (int phase = 0; phase < PHASES_COUNT; phase++) {
+		std::cout << TextFormat("    %-22s %8.2f ms  (p50 %.2f ms)", COLUMN_NAMES[phase], sample.times[phase],
+		                        GetPercentile(phase, 0.5f))
+		          << std::endl;
+	}
+}
+
+void FrameProfiler::DrawHistogram(int column, Vector2 position) const {
+	constexpr float binWidth = 4;
+	constexpr float height = FONT_SIZE;
+	std::array<int, HISTOGRAM_BINS> bins{};
+	for (std::size_t i = 0; i < samplesCount; i++) {
+		int bin = (int)(GetSample(i).times[column] / (2 * BUDGET_MS) * HISTOGRAM_BINS);
+		bins[std::clamp(bin, 0, HISTOGRAM_BINS - 1)]++;
+	}
+
+	int highestBin = std::max(*std::max_element(bins.begin(), bins.end()), 1);
+	for (int bin = 0; bin < HISTOGRAM_BINS; bin++) {
+		float barHeight = height * (float)bins[bin] / (float)highestBin;
+		// Second half of bins lies over the budget
+		Color color = bin < HISTOGRAM_BINS / 2 ? HIGHLIGHT_COLOR : RED;
+		DrawRectangleV(Vector2(position.x + (float)bin * binWidth, position.y + height - barHeight),
+		               Vector2(binWidth - 1, barHeight), color);
+	}
+}
+
+void FrameProfiler::Draw() const {
+	if (!isEnabled) {
+		return;
+	}
+	constexpr int padding = 10;
+	constexpr int nameWidth = 240;
+	constexpr int textWidth = nameWidth + 240;
+	constexpr int histogramWidth = HISTOGRAM_BINS * 4;
+	constexpr int rowHeight = FONT_SIZE + padding / 2;
+
+	DrawRectangle(padding, padding, textWidth + histogramWidth + 3 * padding,
+	              (PHASES_COUNT + 1) * rowHeight + padding * 3 / 2, Fade(BLACK, 0.75f));
+	for (int column = 0; column <= TOTAL_COLUMN; column++) {
+		int y = 2 * padding + column * rowHeight;
+		// Default font isn't monospaced, so the names and the numbers are aligned separately
+		DrawText(COLUMN_NAMES[column], 2 * padding, y, FONT_SIZE, WHITE);
+		DrawText(TextFormat("p50 %.2f  p99 %.2f ms", GetPercentile(column, 0.5f), GetPercentile(column, 0.99f)),
+		         2 * padding + nameWidth, y, FONT_SIZE, WHITE);
+		DrawHistogram(column, Vector2((float)(2 * padding + textWidth), (float)y));
+	}
+}
+
+void FrameProfiler::ExportCsv(const std::string& path) const {
+	std::ofstream file(path);
+	if (!file) {
+		throw std::runtime_error("Can't open frame profile file " + path);
+	}
+
+	file << "frame,start_s";
+	for (const char* name : COLUMN_NAMES) {
+		file << ',' << name << "_ms";
+	}
+	file << '\n';
+	for (std::size_t i = 0; i < samplesCount; i++) {
+		const auto& sample = GetSample(i);
+		file << sample.frameNumber << ',' << sample.startTime;
+		for (float time : sample.times) {
+			file << ',' << time;
+		}
+		file << '\n';
+	}
+
+	if (!file) {
+		throw std::runtime_error("Can't write frame profile file " + path);
+	}
+}
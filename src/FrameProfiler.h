@@ -0,0 +1,216 @@
+/**
+ * @file FrameProfiler.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains profiler measuring phases of frames
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include "common.h"
+#include "raylib.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Measured phases of the frame.
+ */
+enum class FramePhase {
+	CHECK_INPUTS,          /**< GameEngine::CheckInputs without the update of possible moves. */
+	UPDATE_POSSIBLE_MOVES, /**< GameEngine::UpdatePossibleMovesOnSelectedTile. */
+	RENDER_BASE_LAYOUT,    /**< GameEngine::RenderBaseLayout. */
+	RENDER_REST,           /**< GameEngine::RenderRest. */
+	END_DRAWING            /**< EndDrawing of raylib, swapping the buffers and polling the events. */
+};
+
+/**
+ * @brief Measures the phases of frames and shows them in an overlay.
+ *
+ * The profiler is turned on and off by F3 at runtime. While it is on, frames are rendered continuously without the
+ * limit of FPS, so the measured times are the real work of frames. The overlay shows the median and the 99th
+ * percentile of the last HISTORY_SIZE frames with histogram for every phase. Every frame slower than the budget of FPS
+ * is printed with all its phases. F4 exports the measured frames to FRAME_PROFILE_FILE.
+ */
+class FrameProfiler {
+public:
+	static constexpr int PHASES_COUNT = 5; /**< Number of measured phases. */
+
+	/**
+	 * @brief Measures the phase for the default profiler from its construction to its destruction.
+	 */
+	class ScopedTimer {
+	public:
+		/**
+		 * @brief Starts the measuring, if the default profiler is on.
+		 *
+		 * @param phase The measured phase.
+		 */
+		explicit ScopedTimer(FramePhase phase) : phase(phase), isRunning(defaultProfiler.isEnabled) {
+			if (isRunning) {
+				start = std::chrono::steady_clock::now();
+			}
+		}
+
+		/**
+		 * @brief Adds the measured time to the current frame of the default profiler.
+		 */
+		~ScopedTimer() {
+			if (isRunning) {
+				defaultProfiler.AddPhaseTime(phase, std::chrono::steady_clock::now() - start);
+			}
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		FramePhase phase;                                  /**< The measured phase. */
+		bool isRunning;                                    /**< Flag indicating whether the phase is measured. */
+		std::chrono::steady_clock::time_point start = {}; /**< Time of the start of the phase. */
+	};
+
+	/**
+	 * @brief Constructs a new FrameProfiler object, which is off.
+	 */
+	FrameProfiler() = default;
+
+	/**
+	 * @brief Checks the keys of the profiler.
+	 *
+	 * F3 turns the profiler on or off, F4 exports the measured frames to FRAME_PROFILE_FILE.
+	 *
+	 * @return True if the profiler was turned on or off, false otherwise.
+	 * @throws std::runtime_error If the export file can't be written.
+	 */
+	bool CheckInputs();
+
+	/**
+	 * @brief Checks if the profiler measures frames.
+	 *
+	 * @return True if the profiler is on, false otherwise.
+	 */
+	bool IsEnabled() const { return isEnabled; }
+
+	/**
+	 * @brief Starts measuring of the new frame.
+	 */
+	void BeginFrame();
+
+	/**
+	 * @brief Finishes measuring of the frame and prints it, if it was over the budget.
+	 */
+	void EndFrame();
+
+	/**
+	 * @brief Draws the overlay with the percentiles and histograms of the phases.
+	 */
+	void Draw() const;
+
+	/**
+	 * @brief Writes the measured frames as CSV, one line per frame from the oldest.
+	 *
+	 * @param path The path to the written file.
+	 * @throws std::runtime_error If the file can't be written.
+	 */
+	void ExportCsv(const std::string& path) const;
+
+	/**
+	 * @brief Get the profiler used by ScopedTimer.
+	 *
+	 * @return The default profiler.
+	 */
+	static FrameProfiler& GetDefault() { return defaultProfiler; }
+
+private:
+	static constexpr std::size_t HISTORY_SIZE = 240;  /**< Number of last frames kept for statistics. */
+	static constexpr int HISTOGRAM_BINS = 30;         /**< Number of bins of histogram, spanning twice the budget. */
+	static constexpr int TOTAL_COLUMN = PHASES_COUNT; /**< Index of the time of the whole frame after the phases. */
+	static constexpr float BUDGET_MS = 1000.0f / FPS; /**< Time of one frame at FPS in milliseconds. */
+
+	/**
+	 * @brief Names of the phases, as they are shown in the overlay and in the CSV header.
+	 */
+	static constexpr std::array<const char*, PHASES_COUNT + 1> COLUMN_NAMES = {
+		"check_inputs", "update_possible_moves", "render_base_layout", "render_rest", "end_drawing", "total"
+	};
+
+	/**
+	 * @brief Measured times of one frame.
+	 */
+	struct frameSample {
+		std::uint64_t frameNumber = 0;               /**< Number of the iteration of the main loop. */
+		double startTime = 0;                        /**< Time of the start of the frame from GetTime. */
+		std::array<float, PHASES_COUNT + 1> times{}; /**< Milliseconds of every phase and the whole frame. */
+	};
+
+	/**
+	 * @brief Turns the profiler on or off and removes the limit of FPS while it is on.
+	 *
+	 * @param enabled True to turn the profiler on.
+	 */
+	void SetEnabled(bool enabled);
+
+	/**
+	 * @brief Adds the time to the phase of the current frame.
+	 *
+	 * @param phase The measured phase.
+	 * @param duration The measured time.
+	 */
+	void AddPhaseTime(FramePhase phase, std::chrono::steady_clock::duration duration) {
+		currentFrame.times[(int)phase] += std::chrono::duration<float, std::milli>(duration).count();
+	}
+
+	/**
+	 * @brief Get the percentile of the column over the kept frames.
+	 *
+	 * @param column The index of the phase or TOTAL_COLUMN.
+	 * @param percentile The percentile between 0 and 1.
+	 * @return Milliseconds of the percentile, 0 if no frame is kept.
+	 */
+	float GetPercentile(int column, float percentile) const;
+
+	/**
+	 * @brief Prints the frame over the budget with all its phases and the medians for comparison.
+	 *
+	 * @param sample The frame over the budget.
+	 */
+	void PrintSlowFrame(const frameSample& sample) const;
+
+	/**
+	 * @brief Draws the histogram of the column over the kept frames.
+	 *
+	 * @param column The index of the phase or TOTAL_COLUMN.
+	 * @param position The top left corner of the histogram.
+	 */
+	void DrawHistogram(int column, Vector2 position) const;
+
+	/**
+	 * @brief Get the kept frame, 0 is the oldest one.
+	 *
+	 * @param index The index of the frame from the oldest.
+	 * @return The kept frame.
+	 */
+	const frameSample& GetSample(std::size_t index) const {
+		return history[(nextSampleIndex + HISTORY_SIZE - samplesCount + index) % HISTORY_SIZE];
+	}
+
+	bool isEnabled = false;                           /**< Flag indicating whether frames are measured. */
+	std::array<frameSample, HISTORY_SIZE> history{};  /**< Ring buffer of the kept frames. */
+	std::size_t samplesCount = 0;                     /**< Number of the kept frames. */
+	std::size_t nextSampleIndex = 0;                  /**< Index of history for the next frame. */
+	std::uint64_t framesCount = 0;                    /**< Number of iterations of the main loop so far. */
+	frameSample currentFrame;                         /**< The measured frame. */
+	std::chrono::steady_clock::time_point frameStart; /**< Time of the start of the measured frame. */
+
+	static FrameProfiler defaultProfiler; /**< The profiler used by ScopedTimer. */
+};
+
+#endif  // !FRAME_PROFILER_H
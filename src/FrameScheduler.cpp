@@ -0,0 +1,23 @@
+#include "FrameScheduler.h"
+
+void FrameScheduler::BeginFrame() {
+	isInvalidated = false;
+	SetEventWaiting(CanWaitForEvents());
+}
+
+void FrameScheduler::WaitForEvents() {
+	SetEventWaiting(CanWaitForEvents());
+	PollInputEvents();
+}
+
+void FrameScheduler::SetEventWaiting(bool isWaiting) {
+	if (isWaiting == isEventWaiting) {
+		return;
+	}
+	if (isWaiting) {
+		EnableEventWaiting();
+	} else {
+		DisableEventWaiting();
+	}
+	isEventWaiting = isWaiting;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file FrameScheduler.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains scheduler deciding when a frame has to be rendered
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include "raylib.h"
+
+/**
+ * @brief Renders frames only when something has changed.
+ *
+ * The frame is needed after invalidation, that is input changing the game or the view, move etc., and during
+ * animations. Otherwise the main loop waits for input events of raylib without rendering or swapping, so the idle game
+ * uses neither CPU nor GPU. The frame after invalidation is rendered as soon as the event wakes the loop, so the input
+ * doesn't wait for any frame period.
+ *
+ * Only the main thread can invalidate the frame, as nothing else can wake raylib waiting for events.
+ */
+class FrameScheduler {
+public:
+	/**
+	 * @brief Constructs a new FrameScheduler object, the first frame is needed.
+	 */
+	FrameScheduler() = default;
+
+	/**
+	 * @brief Marks that the next frame has to be rendered.
+	 */
+	void Invalidate() { isInvalidated = true; }
+
+	/**
+	 * @brief Registers running animation, frames are rendered continuously until it ends.
+	 */
+	void BeginAnimation() { animationsCount++; }
+
+	/**
+	 * @brief Unregisters the animation registered by BeginAnimation.
+	 */
+	void EndAnimation() { animationsCount--; }
+
+	/**
+	 * @brief Checks if the frame has to be rendered.
+	 *
+	 * @return True if the frame has to be rendered, false otherwise.
+	 */
+	bool IsFrameNeeded() const { return isInvalidated || animationsCount > 0; }
+
+	/**
+	 * @brief Starts rendering of the needed frame.
+	 *
+	 * Clears the invalidation and lets EndDrawing of this frame wait for the next event, if nothing else will need the
+	 * next frame.
+	 */
+	void BeginFrame();
+
+	/**
+	 * @brief Waits until some event may need the next frame, instead of rendering the frame.
+	 */
+	void WaitForEvents();
+
+private:
+	/**
+	 * @brief Turns waiting for events of raylib on or off.
+	 *
+	 * @param isWaiting True if polling events blocks until some event comes.
+	 */
+	void SetEventWaiting(bool isWaiting);
+
+	/**
+	 * @brief Checks if polling events can block until some event comes.
+	 *
+	 * @return True if nothing but input events can need the next frame.
+	 */
+	bool CanWaitForEvents() const { return animationsCount == 0; }
+
+	bool isInvalidated = true;   /**< Flag indicating whether the next frame has to be rendered. */
+	int animationsCount = 0;     /**< Number of running animations. */
+	bool isEventWaiting = false; /**< Flag indicating whether waiting for events of raylib is on. */
+};
+
+#endif  // !FRAME_SCHEDULER_H
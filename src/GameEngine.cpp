@@ -1,8 +1,10 @@
 #include "GameEngine.h"
+#include "FrameProfiler.h"
 #include "hexUtilities.h"
 #include "raylib.h"
 #include "raymath.h"
 #include "rlgl.h"
+#include "Trace.h"
 
 #include <algorithm>
 #include <format>
@@ -15,23 +17,37 @@
 
 GameEngine::GameEngine() {
 	hexagonHorizontalCount = renderer.GetHexagonHorizontalCount();
-	gameMap = GenerateBaseMap();
 	PlayerNameConfiguration();
 
-	// Center of board is the first possible move
+	// Center of the default view is the first possible move
 	borderOfHive.emplace(hexagonHorizontalCount / 2, (HEXAGON_VERTICAL_COUNT - hexagonHorizontalCount / 2) / 2);
 }
-void GameEngine::CheckInputs() {
-	if (!gameInterupted) {
-		if (IsMouseButtonPressed(0)) {
+bool GameEngine::CheckInputs() {
+	TRACE_SCOPE("GameEngine::CheckInputs");
+	bool isChanged = false;
+	bool isClicked = false;
+	{
+		// Update of possible moves is measured as its own phase, so it is left out of this one
+		FrameProfiler::ScopedTimer timer(FramePhase::CHECK_INPUTS);
+		// Layout has to be updated before the cursor is mapped onto it
+		isChanged = renderer.CheckWindowResized();
+		// View can be moved even after the end of the game
+		isChanged |= renderer.MoveCamera();
+		isClicked = !gameInterupted && IsMouseButtonPressed(0);
+		if (isClicked) {
 			if (renderer.IsMouseInPlayersFields()) {
 				CheckInputInPlayerField();
 			} else {
 				CheckInputInHexMap();
 			}
-			UpdatePossibleMovesOnSelectedTile();
 		}
 	}
+	if (isClicked) {
+		UpdatePossibleMovesOnSelectedTile();
+		// Every click changes the selection or makes a move
+		isChanged = true;
+	}
+	return isChanged;
 }
 
 void GameEngine::CheckInputInPlayerField() {
@@ -43,28 +59,7 @@ void GameEngine::CheckInputInPlayerField() {
 		auto selectedPiece = playerAvaiblePieces[indexOfPlayerTileSelected];
 		if (selectedPiece.second > 0 &&
 		    (turn != 4 || indexOfPlayerTileSelected == 0 || players[idOfPlayerOnTurn].HasPlacedQueen())) {
-			switch (selectedPiece.first) {
-				case bugType::QUEEN_BEE:
-					pointerToSelectedTile =
-					    std::make_shared<QueenBee>(players[idOfPlayerOnTurn].GetTileDataAtIndex(indexOfPlayerTileSelected));
-					break;
-				case bugType::BEETLE:
-					pointerToSelectedTile =
-					    std::make_shared<Beetle>(players[idOfPlayerOnTurn].GetTileDataAtIndex(indexOfPlayerTileSelected));
-					break;
-				case bugType::SOLDIER_ANT:
-					pointerToSelectedTile = std::make_shared<SoldierAnt>(
-					    players[idOfPlayerOnTurn].GetTileDataAtIndex(indexOfPlayerTileSelected));
-					break;
-				case bugType::SPIDER:
-					pointerToSelectedTile =
-					    std::make_shared<Spider>(players[idOfPlayerOnTurn].GetTileDataAtIndex(indexOfPlayerTileSelected));
-					break;
-				case bugType::GRASS_HOPPER:
-					pointerToSelectedTile = std::make_shared<GrassHopper>(
-					    players[idOfPlayerOnTurn].GetTileDataAtIndex(indexOfPlayerTileSelected));
-					break;
-			}
+			selectedPieceId = players[idOfPlayerOnTurn].GetPieceIdAtIndex(indexOfPlayerTileSelected);
 		} else {
 			InvalidateSelectedTileVariables();
 		}
@@ -74,41 +69,33 @@ void GameEngine::CheckInputInPlayerField() {
 }
 
 void GameEngine::CheckInputInHexMap() {
-	auto tempIterator = FindIteratorOfHexUnderCursor();
-	if (tempIterator != gameMap.end()) {
-		if (possibleMovesOfSelectedTile.contains(tempIterator->first) && pointerToSelectedTile != nullptr) {
-			MoveHex(tempIterator);
-		} else if (tempIterator->second != nullptr && tempIterator->second->GetPlayerID() == idOfPlayerOnTurn) {
-			InvalidateSelectedTileVariables();
-			if (turn != 4 || players[idOfPlayerOnTurn].HasPlacedQueen()) {
-				pointerToSelectedTile = tempIterator->second;
-				originalCordsOfSelectedTile = tempIterator->first;
-			}
+	HexCords cords = renderer.FindCordsOfHexUnderCursor();
+	if (possibleMovesOfSelectedTile.contains(cords) && selectedPieceId != NO_PIECE) {
+		MoveHex(cords);
+	} else if (pieceId piece = hiveBoard.GetPieceAt(cords);
+	           piece != NO_PIECE && GetPlayerIdOfPiece(piece) == idOfPlayerOnTurn) {
+		InvalidateSelectedTileVariables();
+		if (turn != 4 || players[idOfPlayerOnTurn].HasPlacedQueen()) {
+			selectedPieceId = piece;
+			originalCordsOfSelectedTile = cords;
 		}
 	} else {
 		InvalidateSelectedTileVariables();
 	}
 }
 
-void GameEngine::MoveHex(hexTileMap::iterator& mapIterator) {
+void GameEngine::MoveHex(const HexCords& cords) {
+	TRACE_SCOPE("GameEngine::MoveHex");
 	if (isPlayerTileSelected) {
-		mapIterator->second = pointerToSelectedTile;
+		hiveBoard.PlacePiece(selectedPieceId, cords);
 		players[idOfPlayerOnTurn].ModifieAvaiblePiecesCount(indexOfPlayerTileSelected, -1);
-		ModifyBorderOfHive(mapIterator->first);
 	} else {
-		auto tempIt = gameMap.find(originalCordsOfSelectedTile);
-		if (tempIt != gameMap.end()) {
-			if (auto beetle = dynamic_pointer_cast<Beetle>(pointerToSelectedTile)) {
-				tempIt->second = beetle->GetTileUnderBeetle();
-				beetle->SetTileUnderBeetle(mapIterator->second);
-			} else {
-				tempIt->second = nullptr;
-			}
-		}
-		mapIterator->second = pointerToSelectedTile;
-
-		ModifyBorderOfHive(mapIterator->first, originalCordsOfSelectedTile);
+		hiveBoard.MovePiece(originalCordsOfSelectedTile, cords);
+		renderer.InvalidateHex(originalCordsOfSelectedTile);
 	}
+	renderer.InvalidateHex(cords);
+
+	UpdateBorderOfHive();
 	InvalidateSelectedTileVariables();
 	ChangeTurn();
 }
@@ -116,11 +103,17 @@ void GameEngine::MoveHex(hexTileMap::iterator& mapIterator) {
 void GameEngine::ChangeTurn() {
 	switch (CheckGameStatus()) {
 		case GameStatus::NORMAL:
-			if (startingPlayer != idOfPlayerOnTurn) {
-				turn++;
+			PassTurn();
+			if (HasAnyLegalMove(hiveBoard, idOfPlayerOnTurn)) {
+				return;
 			}
-			idOfPlayerOnTurn = (idOfPlayerOnTurn + 1) % 2;
-			return;
+			// Player without any legal move must pass, game where nobody can move is a draw
+			PassTurn();
+			if (HasAnyLegalMove(hiveBoard, idOfPlayerOnTurn)) {
+				return;
+			}
+			messageToDisplay = DRAW_MESSAGE;
+			break;
 		case GameStatus::DRAW:
 			messageToDisplay = DRAW_MESSAGE;
 			break;
@@ -134,6 +127,13 @@ void GameEngine::ChangeTurn() {
 	gameInterupted = true;
 }
 
+void GameEngine::PassTurn() {
+	if (startingPlayer != idOfPlayerOnTurn) {
+		turn++;
+	}
+	idOfPlayerOnTurn = (idOfPlayerOnTurn + 1) % 2;
+}
+
 GameStatus GameEngine::CheckGameStatus() {
 	auto playerOnePlacedQueen = players[0].HasPlacedQueen();
 	auto playerTwoPlacedQueen = players[1].HasPlacedQueen();
@@ -157,86 +157,61 @@ GameStatus GameEngine::CheckGameStatus() {
 	return GameStatus::NORMAL;
 }
 
-bool GameEngine::CheckIfPlayerWon(const int IDOfPlayer) {
-	for (const auto& tile : gameMap) {
-		if (tile.second != nullptr) {
-			if (tile.second->GetBugType() == bugType::QUEEN_BEE && tile.second->GetPlayerID() == (IDOfPlayer + 1) % 2) {
-				if (GetOccupiedNeighborsOfTile(gameMap, tile.first).size() == 6) {
-					return true;
-				}
-			}
-		}
-	}
-	return false;
-}
-
-void GameEngine::ModifyBorderOfHive(const HexCords& presentCordsOfModifiedTile,
-                                    const HexCords& originalPositionOfModifiedTile) {
-	ModifyBorderOfHive(presentCordsOfModifiedTile);
-
-	auto it = gameMap.find(originalPositionOfModifiedTile);
-	if (it != gameMap.end() && it->second == nullptr) {
-		borderOfHive.insert(originalCordsOfSelectedTile);
-		EraseUnnecessarydHexesFromBorder(originalPositionOfModifiedTile);
-	}
-}
-
-void GameEngine::ModifyBorderOfHive(const HexCords& presentCordsOfModifiedTile) {
-	borderOfHive.erase(presentCordsOfModifiedTile);
-	auto tempNeihgbours = GetEmptyNeighborsOfTile(gameMap, presentCordsOfModifiedTile);
-	borderOfHive.merge(tempNeihgbours);
-}
-
-void GameEngine::EraseUnnecessarydHexesFromBorder(const HexCords& originalPositionOfModifiedTile) {
-	auto candidates = GetEmptyNeighborsOfTile(gameMap, originalPositionOfModifiedTile);
-
-	for (const auto& candidate : candidates) {
-		if (!HasSomeBugHexNeighbor(candidate)) {
-			borderOfHive.erase(candidate);
-		}
-	}
-}
+bool GameEngine::CheckIfPlayerWon(const int IDOfPlayer) { return hiveBoard.IsQueenSurrounded((IDOfPlayer + 1) % 2); }
 
-bool GameEngine::HasSomeBugHexNeighbor(const HexCords& hexcords) {
-	return GetOccupiedNeighborsOfTile(gameMap, hexcords).size() > 0;
+void GameEngine::UpdateBorderOfHive() {
+	borderOfHive.clear();
+	hiveBoard.ForEachSpaceIn(hiveBoard.GetBorderOfHive(),
+	                         [this](const HexCords& cords) { borderOfHive.insert(cords); });
 }
 
 void GameEngine::InvalidateSelectedTileVariables() {
 	isPlayerTileSelected = false;
 	indexOfPlayerTileSelected = -1;
-	pointerToSelectedTile = nullptr;
+	selectedPieceId = NO_PIECE;
 	originalCordsOfSelectedTile = { std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
 }
 
 void GameEngine::UpdatePossibleMovesOnSelectedTile() {
-	if (pointerToSelectedTile != nullptr) {
+	TRACE_SCOPE("GameEngine::UpdatePossibleMovesOnSelectedTile");
+	FrameProfiler::ScopedTimer timer(FramePhase::UPDATE_POSSIBLE_MOVES);
+	if (selectedPieceId != NO_PIECE) {
+		possibleMovesOfSelectedTile.clear();
+		auto addPossibleMove = [this](const HexCords& move) { possibleMovesOfSelectedTile.insert(move); };
+
 		if (isPlayerTileSelected) {
-			possibleMovesOfSelectedTile =
-			    pointerToSelectedTile->Place(gameMap, borderOfHive, idOfPlayerOnTurn, turn == 0);
+			if (hiveBoard.GetOccupiedTilesCount() == 0) {
+				// First piece of the game goes to the center of the board
+				possibleMovesOfSelectedTile = borderOfHive;
+			} else {
+				GeneratePlacements(hiveBoard, idOfPlayerOnTurn, addPossibleMove);
+			}
 		} else if (players[idOfPlayerOnTurn].HasPlacedQueen()) {
-			possibleMovesOfSelectedTile =
-			    pointerToSelectedTile->Move(gameMap, borderOfHive, originalCordsOfSelectedTile);
-		} else {
-			possibleMovesOfSelectedTile = possibleMovesSet();
+			GenerateMoves(hiveBoard, selectedPieceId, originalCordsOfSelectedTile,
+			              hiveBoard.GetPieceUnder(selectedPieceId) != NO_PIECE, addPossibleMove);
 		}
 	}
 }
 
 void GameEngine::RenderBaseLayout() {
-	renderer.RenderBaseLayout(gameMap, players, idOfPlayerOnTurn);
+	TRACE_SCOPE("GameEngine::RenderBaseLayout");
+	FrameProfiler::ScopedTimer timer(FramePhase::RENDER_BASE_LAYOUT);
+	renderer.RenderBaseLayout(hiveBoard, players, idOfPlayerOnTurn);
 	if (turn == 4 && !players[idOfPlayerOnTurn].HasPlacedQueen()) {
 		renderer.DisplayQueenMessage();
 	}
 }
 
 void GameEngine::RenderRest() {
+	TRACE_SCOPE("GameEngine::RenderRest");
+	FrameProfiler::ScopedTimer timer(FramePhase::RENDER_REST);
 	if (isPlayerTileSelected) {
 		renderer.HighLightSelectedHex(std::make_pair(idOfPlayerOnTurn, indexOfPlayerTileSelected));
-	} else if (pointerToSelectedTile != nullptr) {
+	} else if (selectedPieceId != NO_PIECE) {
 		renderer.HighLightSelectedHex(originalCordsOfSelectedTile);
 	}
 
-	if (pointerToSelectedTile == nullptr) {
+	if (selectedPieceId == NO_PIECE) {
 		renderer.HighLightPossibleMoves(borderOfHive);
 	} else {
 		renderer.HighLightPossibleMoves(possibleMovesOfSelectedTile);
@@ -251,19 +226,3 @@ void GameEngine::PlayerNameConfiguration() {
 	players[0].SetName("BLACK");
 	players[1].SetName("GRAY");
 }
-
-hexTileMap GameEngine::GenerateBaseMap() {
-	hexTileMap map;
-	for (int i = 0; i < hexagonHorizontalCount; i++) {
-		for (int j = 0; j < HEXAGON_VERTICAL_COUNT; j++) {
-			map.insert(std::make_pair(HexCords(i, j - i / 2), nullptr));
-		}
-	}
-	return map;
-}
-
-hexTileMap::iterator GameEngine::FindIteratorOfHexUnderCursor() {
-	HexCords cord = renderer.FindCordsOfHexUnderCursor();
-	auto it = gameMap.find(cord);
-	return it;
-}
\ No newline at end of file
@@ -14,12 +14,14 @@
 #include "bugTiles.h"
 #include "common.h"
 #include "hexUtilities.h"
+#include "HiveBoard.h"
 #include "Player.h"
 #include "raylib.h"
 #include "raymath.h"
 #include "Renderer.h"
 #include "rlgl.h"
 
+#include <array>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -40,6 +42,9 @@ enum class GameStatus {
  * @brief Represents the game engine.
  *
  * This class manages the game logic and rendering.
+ *
+ * The game is played on the unbounded hiveBoard, the renderer draws it and picks hex tiles under the cursor by its
+ * coordinates. The screen is just a view of the board, the camera can be panned and zoomed to follow the hive.
  */
 class GameEngine {
 public:
@@ -54,8 +59,10 @@ public:
 	 * @brief Checks player inputs.
 	 *
 	 * Checks for player inputs and processes them accordingly.
+	 *
+	 * @return True if the inputs changed the game or the view, so the next frame has to be rendered.
 	 */
-	void CheckInputs();
+	bool CheckInputs();
 
 	/**
 	 * @brief Renders the base layout of the game.
@@ -92,6 +99,7 @@ private:
 	 * @brief Checks if a player has won.
 	 *
 	 * Checks if the specified player has won the game. Meaning that their Queen is surrounded on all sides;
+	 * Reads only the tracked position of the opponent's Queen and the mask of its occupied neighbors.
 	 *
 	 * @param IDOfPlayer The ID of the player to check.
 	 * @return True if the player has won, false otherwise.
@@ -123,7 +131,7 @@ private:
 	 * @brief Invalidates selected tile variables.
 	 *
 	 * Resets the variables related to the selected tile to their default state.
-	 * This variables are reseted: isPlayerTileSelected, indexOfPlayerTileSelected, pointerToSelectedTile,
+	 * This variables are reseted: isPlayerTileSelected, indexOfPlayerTileSelected, selectedPieceId,
 	 * originalCordsOfSelectedTile.
 	 */
 	void InvalidateSelectedTileVariables();
@@ -131,89 +139,45 @@ private:
 	/**
 	 * @brief Moves/Places the selected tile on game map.
 	 *
-	 * Moves or places the selected hex tileto the new position specified by the map iterator.
+	 * Moves or places the selected hex tileto the new position.
 	 *
-	 * @param mapIterator An iterator pointing to places where to put the selected tile.
+	 * @param cords The coordinates of the space where to put the selected tile.
 	 */
-	void MoveHex(hexTileMap::iterator& mapIterator);
+	void MoveHex(const HexCords& cords);
 
 	/**
 	 * @brief Changes the turn in the game.
 	 *
-	 * Changes the turn to the next player in the game and checks the status of the game.
+	 * Changes the turn to the next player in the game and checks the status of the game. Player without any legal
+	 * move passes automatically.
 	 */
 	void ChangeTurn();
 
 	/**
-	 * @brief Modifies the border of the hive based on the move of a tile.
-	 *
-	 * Modifies the border of the hive based on the move of a tile, considering both
-	 * the present position and the original position of the modified tile.
-	 *
-	 * @param presentPositionOfModifiedTile The present position of the modified tile.
-	 * @param originalPositionOfModifiedTile The original position of the modified tile.
-	 */
-	void ModifyBorderOfHive(const HexCords& presentPositionOfModifiedTile,
-	                        const HexCords& originalPositionOfModifiedTile);
-	/**
-	 * @brief Modifies the border of the hive based on the move of a tile.
-	 *
-	 * Modifies the border of the hive based on the move of a tile, considering only
-	 * the present position of the modified tile.
-	 *
-	 * @param presentPositionOfModifiedTile The present position of the modified tile.
+	 * @brief Gives the turn to the other player without checking the status of the game.
 	 */
-	void ModifyBorderOfHive(const HexCords& presentPositionOfModifiedTile);
+	void PassTurn();
 
 	/**
-	 * @brief Erases unnecessary hex tiles from the border of the hive.
-	 *
-	 * Removes hex tiles from the border of the hive that are no longer needed
-	 * after a modification.
-	 *
-	 * @param originalPositionOfModifiedTile The original position of the modified tile.
-	 */
-	void EraseUnnecessarydHexesFromBorder(const HexCords& originalPositionOfModifiedTile);
-
-	/**
-	 * @brief Checks if the tile have some occupied neighbors.
-	 *
-	 * Checks if the tile at specified cordinates have atleast 1 occupied neighbors.
-	 *
-	 * @param hexcords The coordinates to check.
-	 * @return True if there are bug hex tile neighbors, false otherwise.
-	 */
-	bool HasSomeBugHexNeighbor(const HexCords& hexcords);
-
-	/**
-	 * @brief Generates the empty base map layout for the game.
-	 *
-	 * @return The generated base map.
-	 */
-	hexTileMap GenerateBaseMap();
-
-	/**
-	 * @brief Finds the iterator of the hex tile under the cursor.
-	 *
-	 * Finds the iterator of the hex tile under the cursor in the game map.
+	 * @brief Updates the border of the hive after a move.
 	 *
-	 * @return The iterator of the hex tile under the cursor.
+	 * Takes the border from the bitboard of hiveBoard.
 	 */
-	hexTileMap::iterator FindIteratorOfHexUnderCursor();
+	void UpdateBorderOfHive();
 
 	Renderer renderer = Renderer(); /**< The renderer object for rendering graphics. */
-	hexTileMap gameMap;             /**< The game map representing hex tiles. */
+	HiveBoard hiveBoard;            /**< The game board on which all moves are generated. */
 
 	possibleMovesSet borderOfHive;                /**< The set of hex tiles representing the border of the hive. */
 	possibleMovesSet possibleMovesOfSelectedTile; /**< The set of possible moves for the currently selected tile. */
 
-	int hexagonHorizontalCount = 0; /**< The number of hexagons horizontally on the game map. */
+	int hexagonHorizontalCount = 0; /**< The number of hexagons horizontally in the default view. */
 
 	// Selected tile variables
 	bool isPlayerTileSelected = false; /**< Flag indicating whether a player tile is currently selected. */
 	int indexOfPlayerTileSelected = 0; /**< The index of the player tile currently selected. */
 
-	std::shared_ptr<BaseBugTile> pointerToSelectedTile = nullptr; /**< A pointer to the currently selected tile. */
+	pieceId selectedPieceId = NO_PIECE; /**< The id of the currently selected piece. */
 	HexCords originalCordsOfSelectedTile = {
 		std::numeric_limits<int>::max(), std::numeric_limits<int>::max()
 	}; /**< The original coordinates of the selected tile. */
@@ -0,0 +1,183 @@
+#include "HexBatch.h"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * @brief Vertex shader placing the hexagon with radius 1 at the position of the instance.
+ */
+static constexpr const char* VERTEX_SHADER = R"(#version 330
+layout(location = 0) in vec2 vertexPosition;
+layout(location = 1) in vec2 instancePosition;
+layout(location = 2) in vec4 instanceBaseColor;
+layout(location = 3) in vec4 instanceSecondaryColor;
+layout(location = 4) in vec4 instanceOutlineColor;
+
+uniform mat4 mvp;
+uniform float radius;
+
+out vec2 hexPosition;
+flat out vec4 baseColor;
+flat out vec4 secondaryColor;
+flat out vec4 outlineColor;
+
+void main() {
+	hexPosition = vertexPosition;
+	baseColor = instanceBaseColor;
+	secondaryColor = instanceSecondaryColor;
+	outlineColor = instanceOutlineColor;
+	gl_Position = mvp * vec4(instancePosition + vertexPosition * radius, 0.0, 1.0);
+}
+)";
+
+/**
+ * @brief Fragment shader choosing the part of the hexagon from the hexagonal distance to its center.
+ */
+static constexpr const char* FRAGMENT_SHADER = R"(#version 330
+in vec2 hexPosition;
+flat in vec4 baseColor;
+flat in vec4 secondaryColor;
+flat in vec4 outlineColor;
+
+uniform float outlineStart;
+uniform float secondaryEnd;
+
+out vec4 finalColor;
+
+void main() {
+	// Distance is 1 on the whole border of the hexagon with radius 1 and a vertex on the x axis
+	vec2 position = abs(hexPosition);
+	float hexDistance = max(position.y, position.x * 0.8660254 + position.y * 0.5) / 0.8660254;
+
+	vec4 color = baseColor;
+	if (hexDistance < secondaryEnd && secondaryColor.a > 0.0) {
+		color = secondaryColor;
+	}
+	if (hexDistance >= outlineStart && outlineColor.a > 0.0) {
+		color = outlineColor;
+	}
+	if (color.a == 0.0) {
+		discard;
+	}
+	finalColor = color;
+}
+)";
+
+void HexBatch::Load() {
+	int version = rlGetVersion();
+	if (version != RL_OPENGL_33 && version != RL_OPENGL_43) {
+		return;
+	}
+
+	shader = LoadShaderFromMemory(VERTEX_SHADER, FRAGMENT_SHADER);
+	// raylib falls back to its default shader when the code doesn't compile
+	if (shader.id == rlGetShaderIdDefault()) {
+		shader = { 0 };
+		return;
+	}
+	mvpLocation = GetShaderLocation(shader, "mvp");
+	radiusLocation = GetShaderLocation(shader, "radius");
+	outlineStartLocation = GetShaderLocation(shader, "outlineStart");
+	secondaryEndLocation = GetShaderLocation(shader, "secondaryEnd");
+
+	// Triangles from the center to every side of the hexagon, as DrawPoly with no rotation
+	std::array<Vector2, HEXAGON_VERTICES_COUNT> vertices;
+	for (int side = 0; side < HEXAGON_SIDES_COUNT; side++) {
+		float angle = side * 2 * PI / HEXAGON_SIDES_COUNT;
+		float nextAngle = (side + 1) * 2 * PI / HEXAGON_SIDES_COUNT;
+		vertices[side * 3] = Vector2(0, 0);
+		vertices[side * 3 + 1] = Vector2(cosf(angle), sinf(angle));
+		vertices[side * 3 + 2] = Vector2(cosf(nextAngle), sinf(nextAngle));
+	}
+
+	vertexArray = rlLoadVertexArray();
+	rlEnableVertexArray(vertexArray);
+	meshBuffer = rlLoadVertexBuffer(vertices.data(), (int)sizeof(vertices), false);
+	rlSetVertexAttribute(0, 2, RL_FLOAT, false, 0, 0);
+	rlEnableVertexAttribute(0);
+	rlDisableVertexArray();
+}
+
+void HexBatch::Unload() {
+	if (IsInstanced()) {
+		rlUnloadVertexArray(vertexArray);
+		rlUnloadVertexBuffer(meshBuffer);
+		rlUnloadVertexBuffer(instanceBuffer);
+		UnloadShader(shader);
+	}
+	shader = { 0 };
+	vertexArray = meshBuffer = instanceBuffer = 0;
+	instanceBufferCapacity = 0;
+}
+
+void HexBatch::SetInstanceAttributes() {
+	constexpr int stride = (int)sizeof(hexInstance);
+	constexpr unsigned int location = INSTANCE_ATTRIBUTES_START;
+	rlSetVertexAttribute(location, 2, RL_FLOAT, false, stride, (void*)offsetof(hexInstance, position));
+	rlSetVertexAttribute(location + 1, 4, RL_UNSIGNED_BYTE, true, stride, (void*)offsetof(hexInstance, baseColor));
+	rlSetVertexAttribute(location + 2, 4, RL_UNSIGNED_BYTE, true, stride,
+	                     (void*)offsetof(hexInstance, secondaryColor));
+	rlSetVertexAttribute(location + 3, 4, RL_UNSIGNED_BYTE, true, stride, (void*)offsetof(hexInstance, outlineColor));
+	for (unsigned int attribute = location; attribute < location + 4; attribute++) {
+		rlEnableVertexAttribute(attribute);
+		rlSetVertexAttributeDivisor(attribute, 1);
+	}
+}
+
+void HexBatch::Draw(float radius, float lineThickness, float secondaryRadius) {
+	if (instances.empty()) {
+		return;
+	}
+	if (!IsInstanced()) {
+		DrawEach(radius, lineThickness, secondaryRadius);
+		instances.clear();
+		return;
+	}
+
+	if (instances.size() > instanceBufferCapacity) {
+		// Capacity doubles, so the buffer is reallocated only few times even for huge boards
+		instanceBufferCapacity = std::bit_ceil(instances.size());
+		rlEnableVertexArray(vertexArray);
+		rlUnloadVertexBuffer(instanceBuffer);
+		instanceBuffer = rlLoadVertexBuffer(nullptr, (int)(instanceBufferCapacity * sizeof(hexInstance)), true);
+		SetInstanceAttributes();
+		rlDisableVertexArray();
+	}
+	rlUpdateVertexBuffer(instanceBuffer, instances.data(), (int)(instances.size() * sizeof(hexInstance)), 0);
+
+	// Shapes batched by raylib so far are drawn first, so the order of drawing is kept
+	rlDrawRenderBatchActive();
+
+	float outlineStart = (radius - lineThickness) / radius;
+	float secondaryEnd = secondaryRadius / radius;
+	Matrix mvp =
+	    MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+
+	rlEnableShader(shader.id);
+	rlSetUniformMatrix(mvpLocation, mvp);
+	rlSetUniform(radiusLocation, &radius, RL_SHADER_UNIFORM_FLOAT, 1);
+	rlSetUniform(outlineStartLocation, &outlineStart, RL_SHADER_UNIFORM_FLOAT, 1);
+	rlSetUniform(secondaryEndLocation, &secondaryEnd, RL_SHADER_UNIFORM_FLOAT, 1);
+	rlEnableVertexArray(vertexArray);
+	rlDrawVertexArrayInstanced(0, HEXAGON_VERTICES_COUNT, (int)instances.size());
+	rlDisableVertexArray();
+	rlDisableShader();
+
+	instances.clear();
+}
+
+void HexBatch::DrawEach(float radius, float lineThickness, float secondaryRadius) const {
+	for (const auto& instance : instances) {
+		if (instance.baseColor.a > 0) {
+			DrawPoly(instance.position, HEXAGON_SIDES_COUNT, radius, 0, instance.baseColor);
+		}
+		if (instance.outlineColor.a > 0) {
+			DrawPolyLinesEx(instance.position, HEXAGON_SIDES_COUNT, radius, 0, lineThickness, instance.outlineColor);
+		}
+		if (instance.secondaryColor.a > 0) {
+			DrawPoly(instance.position, HEXAGON_SIDES_COUNT, secondaryRadius, 0, instance.secondaryColor);
+		}
+	}
+}
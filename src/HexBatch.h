@@ -0,0 +1,121 @@
+/**
+ * @file HexBatch.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains batch drawing many hexagons with one instanced draw call
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef HEX_BATCH_H
+#define HEX_BATCH_H
+
+#include "common.h"
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#include <vector>
+
+/**
+ * @brief Collects hexagons and draws all of them at once.
+ *
+ * One hexagon mesh is kept on the GPU together with buffer of instances, that is position and colors of every added
+ * hexagon. The shader draws the base, the smaller hexagon in the middle and the outline of each instance from the
+ * hexagonal distance of the fragment to the center, so whole batch costs one instanced draw call. Transparent color
+ * leaves the part out, so the same batch draws tiles as well as bare outlines of highlights.
+ *
+ * Instancing needs OpenGL 3.3 backend of raylib, other backends draw the hexagons one by one with the same look.
+ */
+class HexBatch {
+public:
+	/**
+	 * @brief Constructs an empty HexBatch object, Load has to be called once the window exists.
+	 */
+	HexBatch() = default;
+
+	HexBatch(const HexBatch&) = delete;
+	HexBatch& operator=(const HexBatch&) = delete;
+
+	/**
+	 * @brief Loads the shader and buffers, if the backend supports instancing.
+	 */
+	void Load();
+
+	/**
+	 * @brief Releases the shader and buffers.
+	 */
+	void Unload();
+
+	/**
+	 * @brief Checks if the hexagons are drawn by one instanced draw call.
+	 *
+	 * @return True if the shader and buffers are loaded, false otherwise.
+	 */
+	bool IsInstanced() const { return vertexArray != 0; }
+
+	/**
+	 * @brief Adds the hexagon to the batch.
+	 *
+	 * @param position The screen position of the center.
+	 * @param outlineColor The color of the outline, BLANK for none.
+	 * @param baseColor The color of the hexagon, BLANK for none.
+	 * @param secondaryColor The color of the smaller hexagon in the middle, BLANK for none.
+	 */
+	void Add(const Vector2& position, Color outlineColor, Color baseColor, Color secondaryColor = BLANK) {
+		instances.push_back({ position, baseColor, secondaryColor, outlineColor });
+	}
+
+	/**
+	 * @brief Draws all added hexagons and empties the batch.
+	 *
+	 * Hexagons are drawn after everything drawn before by raylib and with its current transformation.
+	 *
+	 * @param radius The radius of the hexagons.
+	 * @param lineThickness The thickness of the outline, it lies inside the radius.
+	 * @param secondaryRadius The radius of the smaller hexagon in the middle.
+	 */
+	void Draw(float radius, float lineThickness, float secondaryRadius);
+
+private:
+	static constexpr int HEXAGON_VERTICES_COUNT = HEXAGON_SIDES_COUNT * 3; /**< Vertices of triangles of the mesh. */
+	static constexpr int INSTANCE_ATTRIBUTES_START = 1; /**< Location of the first attribute of the instance. */
+
+	/**
+	 * @brief One hexagon of the batch, the layout of the instance buffer.
+	 */
+	struct hexInstance {
+		Vector2 position;     /**< The screen position of the center. */
+		Color baseColor;      /**< The color of the hexagon. */
+		Color secondaryColor; /**< The color of the smaller hexagon in the middle. */
+		Color outlineColor;   /**< The color of the outline. */
+	};
+
+	/**
+	 * @brief Points attributes of the vertex array to the current instance buffer.
+	 */
+	void SetInstanceAttributes();
+
+	/**
+	 * @brief Draws added hexagons by raylib shapes, for backends without instancing.
+	 *
+	 * @param radius The radius of the hexagons.
+	 * @param lineThickness The thickness of the outline.
+	 * @param secondaryRadius The radius of the smaller hexagon in the middle.
+	 */
+	void DrawEach(float radius, float lineThickness, float secondaryRadius) const;
+
+	std::vector<hexInstance> instances;  /**< Hexagons added since the last draw. */
+	Shader shader = { 0 };               /**< The shader drawing the instances. */
+	int mvpLocation = -1;                /**< Location of the transformation uniform. */
+	int radiusLocation = -1;             /**< Location of the radius uniform. */
+	int outlineStartLocation = -1;       /**< Location of the uniform of relative inner edge of the outline. */
+	int secondaryEndLocation = -1;       /**< Location of the uniform of relative radius of the smaller hexagon. */
+	unsigned int vertexArray = 0;        /**< The vertex array with the mesh and the instance attributes. */
+	unsigned int meshBuffer = 0;         /**< Vertices of the hexagon with radius 1. */
+	unsigned int instanceBuffer = 0;     /**< The buffer of instances. */
+	size_t instanceBufferCapacity = 0;   /**< Number of instances fitting into the buffer. */
+};
+
+#endif  // !HEX_BATCH_H
@@ -0,0 +1,186 @@
+/**
+ * @file HexBitboard.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the bitset of spaces in a fixed window of axial coordinates
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef HEX_BITBOARD_H
+#define HEX_BITBOARD_H
+
+#include "common.h"
+#include "hexUtilities.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+/**
+ * @brief Set of spaces in the window of SIZE x SIZE axial coordinates, one bit per space.
+ *
+ * Coordinates are relative to the middle of the window, both q and r lie in [-SIZE / 2, SIZE / 2). Each row of the
+ * window has constant r and bit q + SIZE / 2 of the row represents the space (q, r). Neighbors in the row are then
+ * neighboring bits and neighbors in the next or previous row are the same or neighboring bits, so set of all
+ * neighbors of the set is computed by few shifts and ORs (see Dilate).
+ */
+class HexBitboard {
+public:
+	static constexpr int SIZE = 32; /**< Number of rows and spaces in every row of the window. */
+	using row = std::uint32_t;      /**< One row of the window. */
+
+	/**
+	 * @brief Checks if the space is in the set.
+	 *
+	 * @param relativeCords The coordinates of the space relative to the middle of the window.
+	 * @return True if the space is in the set, false otherwise.
+	 */
+	constexpr bool Test(const HexCords& relativeCords) const {
+		return (rows[relativeCords.r + SIZE / 2] >> (relativeCords.q + SIZE / 2)) & 1;
+	}
+
+	/**
+	 * @brief Adds the space to the set.
+	 *
+	 * @param relativeCords The coordinates of the space relative to the middle of the window.
+	 */
+	constexpr void Set(const HexCords& relativeCords) {
+		rows[relativeCords.r + SIZE / 2] |= (row)1 << (relativeCords.q + SIZE / 2);
+	}
+
+	/**
+	 * @brief Removes the space from the set.
+	 *
+	 * @param relativeCords The coordinates of the space relative to the middle of the window.
+	 */
+	constexpr void Reset(const HexCords& relativeCords) {
+		rows[relativeCords.r + SIZE / 2] &= ~((row)1 << (relativeCords.q + SIZE / 2));
+	}
+
+	/**
+	 * @brief Removes all spaces from the set.
+	 */
+	constexpr void Clear() { rows.fill(0); }
+
+	/**
+	 * @brief Get the set of spaces, that have atleast one neighbor in the set.
+	 *
+	 * Spaces of the set are included only if they have neighbor in the set. Neighbors outside of the window are lost.
+	 *
+	 * @return HexBitboard
+	 */
+	constexpr HexBitboard Dilate() const {
+		HexBitboard result;
+		for (int i = 0; i < SIZE; i++) {
+			// Neighbors (q + 1, r) and (q - 1, r)
+			row dilated = (rows[i] >> 1) | (rows[i] << 1);
+			if (i > 0) {
+				// Neighbors (q, r - 1) and (q + 1, r - 1)
+				dilated |= rows[i - 1] | (rows[i - 1] >> 1);
+			}
+			if (i < SIZE - 1) {
+				// Neighbors (q, r + 1) and (q - 1, r + 1)
+				dilated |= rows[i + 1] | (rows[i + 1] << 1);
+			}
+			result.rows[i] = dilated;
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Intersection operator.
+	 * @param other The other set.
+	 * @return Spaces present in both sets.
+	 */
+	constexpr HexBitboard operator&(const HexBitboard& other) const {
+		HexBitboard result;
+		for (int i = 0; i < SIZE; i++) {
+			result.rows[i] = rows[i] & other.rows[i];
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Union operator.
+	 * @param other The other set.
+	 * @return Spaces present in any of the sets.
+	 */
+	constexpr HexBitboard operator|(const HexBitboard& other) const {
+		HexBitboard result;
+		for (int i = 0; i < SIZE; i++) {
+			result.rows[i] = rows[i] | other.rows[i];
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Complement operator.
+	 * @return Spaces of the window not present in the set.
+	 */
+	constexpr HexBitboard operator~() const {
+		HexBitboard result;
+		for (int i = 0; i < SIZE; i++) {
+			result.rows[i] = ~rows[i];
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Equality operator.
+	 * @param other The other set.
+	 * @return True if both sets contain the same spaces, false otherwise.
+	 */
+	constexpr bool operator==(const HexBitboard& other) const = default;
+
+	/**
+	 * @brief Checks if the set is empty.
+	 *
+	 * @return True if there is no space in the set, false otherwise.
+	 */
+	constexpr bool IsEmpty() const {
+		row result = 0;
+		for (const auto& oneRow : rows) {
+			result |= oneRow;
+		}
+		return result == 0;
+	}
+
+	/**
+	 * @brief Get the number of spaces in the set.
+	 *
+	 * @return int
+	 */
+	constexpr int Count() const {
+		int result = 0;
+		for (const auto& oneRow : rows) {
+			result += std::popcount(oneRow);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Calls function for every space in the set.
+	 *
+	 * @param function Callable taking coordinates of the space relative to the middle of the window, it can stop the
+	 * iteration by returning true.
+	 * @return True if the function stopped the iteration, false otherwise.
+	 */
+	template <typename Function>
+	constexpr bool ForEachSpace(Function&& function) const {
+		for (int i = 0; i < SIZE; i++) {
+			for (row oneRow = rows[i]; oneRow != 0; oneRow &= oneRow - 1) {
+				if (CallAndCheckStop(function, HexCords(std::countr_zero(oneRow) - SIZE / 2, i - SIZE / 2))) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+private:
+	std::array<row, SIZE> rows = {}; /**< Rows of the window ordered by r. */
+};
+
+#endif  // !HEX_BITBOARD_H
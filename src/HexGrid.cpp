@@ -0,0 +1,39 @@
+#include "HexGrid.h"
+
+HexGrid::HexGrid(int horizontalCount, int verticalCount)
+    : horizontalCount(horizontalCount), verticalCount(verticalCount) {
+	tiles.reserve((size_t)horizontalCount * verticalCount);
+	for (int i = 0; i < horizontalCount; i++) {
+		for (int j = 0; j < verticalCount; j++) {
+			tiles.emplace_back(HexCords(i, j - i / 2), NO_PIECE);
+		}
+	}
+
+	occupiedNeighbors.assign(tiles.size(), 0);
+	onMapNeighbors.assign(tiles.size(), 0);
+	for (size_t index = 0; index < tiles.size(); index++) {
+		for (int i = 0; i < SIZE_OF_AXIAL_VECTORS; i++) {
+			if (GetIndexOfCords(tiles[index].first + AXIAL_DIRECTION_VECTORS[i]) != -1) {
+				onMapNeighbors[index] |= (neighborsMask)(1 << i);
+			}
+		}
+	}
+}
+
+void HexGrid::SetPiece(const HexCords& cords, pieceId piece) {
+	auto& tile = tiles[GetIndexOfCords(cords)];
+	bool wasOccupied = tile.second != NO_PIECE;
+	bool isOccupied = piece != NO_PIECE;
+	tile.second = piece;
+
+	if (wasOccupied != isOccupied) {
+		occupiedTilesCount += isOccupied ? 1 : -1;
+		for (int i = 0; i < SIZE_OF_AXIAL_VECTORS; i++) {
+			int index = GetIndexOfCords(cords + AXIAL_DIRECTION_VECTORS[i]);
+			if (index != -1) {
+				// The space is neighbor of its neighbor in the opposite direction
+				occupiedNeighbors[index] ^= (neighborsMask)(1 << GetOppositeDirection(i));
+			}
+		}
+	}
+}
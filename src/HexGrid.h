@@ -0,0 +1,217 @@
+/**
+ * @file HexGrid.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the flat array game board used by the interactive game
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef HEX_GRID_H
+#define HEX_GRID_H
+
+#include "common.h"
+#include "hexUtilities.h"
+
+#include <utility>
+#include <vector>
+
+/**
+ * @typedef hexTile
+ * @brief Space of the game board, its coordinates and id of the piece on top of it (NO_PIECE for empty space).
+ */
+using hexTile = std::pair<HexCords, pieceId>;
+
+/**
+ * @brief Game board with fixed rectangular shape stored in contiguous array.
+ *
+ * Columns of the board have constant q, row j of column q has r = j - q / 2, so the board looks like rectangle on
+ * the screen. Spaces are stored column by column, which is the same order as ordering of HexCords, and index of space
+ * is computed from its coordinates in O(1).
+ *
+ * The board also keeps mask of occupied neighbors of every space, so pieces can be changed only through SetPiece.
+ */
+class HexGrid {
+public:
+	using const_iterator = std::vector<hexTile>::const_iterator; /**< Iterator over spaces of the board. */
+	using iterator = const_iterator;                             /**< Iterator over spaces of the board. */
+
+	/**
+	 * @brief Constructs an empty HexGrid object without any space.
+	 */
+	HexGrid() = default;
+
+	/**
+	 * @brief Constructs an empty HexGrid object.
+	 *
+	 * @param horizontalCount Number of columns of the board.
+	 * @param verticalCount Number of spaces in every column.
+	 */
+	HexGrid(int horizontalCount, int verticalCount);
+
+	/**
+	 * @brief Get the index of the space in the array.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return The index of the space or -1 if the space is not part of the board.
+	 */
+	int GetIndexOfCords(const HexCords& cords) const { return GetIndexOfCords(cords, horizontalCount, verticalCount); }
+
+	/**
+	 * @brief Get the index of the space in the array of the board with given size.
+	 *
+	 * Lets arrays of other data about spaces share the indices of the board.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @param horizontalCount Number of columns of the board.
+	 * @param verticalCount Number of spaces in every column.
+	 * @return The index of the space or -1 if the space is not part of the board.
+	 */
+	static int GetIndexOfCords(const HexCords& cords, int horizontalCount, int verticalCount) {
+		int column = cords.q;
+		int row = cords.r + cords.q / 2;
+		if (column < 0 || column >= horizontalCount || row < 0 || row >= verticalCount) {
+			return -1;
+		}
+		return column * verticalCount + row;
+	}
+
+	/**
+	 * @brief Finds the space on the board.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return Iterator to the space or end() if the space is not part of the board.
+	 */
+	const_iterator find(const HexCords& cords) const {
+		int index = GetIndexOfCords(cords);
+		return index == -1 ? tiles.end() : tiles.begin() + index;
+	}
+
+	const_iterator begin() const { return tiles.begin(); } /**< Iterator to the first space of the board. */
+	const_iterator end() const { return tiles.end(); }     /**< Iterator behind the last space of the board. */
+
+	/**
+	 * @brief Sets the piece on top of the space.
+	 *
+	 * Updates masks of occupied neighbors of the surrounding spaces if the space became empty or occupied.
+	 *
+	 * @param cords The coordinates of the space, must be part of the board.
+	 * @param piece The id of the piece or NO_PIECE to make the space empty.
+	 */
+	void SetPiece(const HexCords& cords, pieceId piece);
+
+	/**
+	 * @brief Get the number of occupied spaces.
+	 *
+	 * @return int
+	 */
+	int GetOccupiedTilesCount() const { return occupiedTilesCount; }
+
+	/**
+	 * @brief Get the mask of occupied neighbors of the space.
+	 *
+	 * @param index The index of the space.
+	 * @return neighborsMask
+	 */
+	neighborsMask GetOccupiedNeighborsMaskAtIndex(int index) const { return occupiedNeighbors[index]; }
+
+	/**
+	 * @brief Get the mask of neighbors of the space, that are part of the board.
+	 *
+	 * @param index The index of the space.
+	 * @return neighborsMask
+	 */
+	neighborsMask GetOnMapNeighborsMaskAtIndex(int index) const { return onMapNeighbors[index]; }
+
+	/**
+	 * @brief Get the number of spaces of the board.
+	 *
+	 * @return int
+	 */
+	int GetSize() const { return (int)tiles.size(); }
+
+private:
+	int horizontalCount = 0;                      /**< Number of columns of the board. */
+	int verticalCount = 0;                        /**< Number of spaces in every column. */
+	std::vector<hexTile> tiles;                   /**< Spaces of the board ordered column by column. */
+	std::vector<neighborsMask> occupiedNeighbors; /**< Mask of occupied neighbors of every space. */
+	std::vector<neighborsMask> onMapNeighbors;    /**< Mask of neighbors of every space, that are on the board. */
+	int occupiedTilesCount = 0;                   /**< Number of occupied spaces. */
+};
+
+/**
+ * @brief Get the piece lying on top of the space.
+ *
+ * @param gameMap The game board.
+ * @param cords The coordinates of the space.
+ * @return The id of the piece on top of the space or NO_PIECE if the space is empty or not on the board.
+ */
+inline pieceId GetPieceAt(const HexGrid& gameMap, const HexCords& cords) {
+	auto it = gameMap.find(cords);
+	return it != gameMap.end() ? it->second : NO_PIECE;
+}
+
+/**
+ * @brief Checks if the space is part of the game board.
+ *
+ * @param gameMap The game board.
+ * @param cords The coordinates of the space.
+ * @return True if pieces can be put on the space, false otherwise.
+ */
+inline bool IsOnMap(const HexGrid& gameMap, const HexCords& cords) { return gameMap.GetIndexOfCords(cords) != -1; }
+
+/**
+ * @brief Get the number of occupied spaces of the game board.
+ *
+ * @param gameMap The game board.
+ * @return int
+ */
+inline int GetOccupiedTilesCount(const HexGrid& gameMap) { return gameMap.GetOccupiedTilesCount(); }
+
+/**
+ * @brief Calls function for every occupied space of the game board.
+ *
+ * @param gameMap The game board.
+ * @param function Callable taking coordinates of the space and id of the piece on top of it.
+ */
+template <typename Function>
+void ForEachOccupiedTile(const HexGrid& gameMap, Function&& function) {
+	for (const auto& [cords, piece] : gameMap) {
+		if (piece != NO_PIECE) {
+			function(cords, piece);
+		}
+	}
+}
+
+/**
+ * @brief Get the mask of occupied neighbors of a tile.
+ *
+ * Reads the mask kept by the board, so it is O(1) for spaces of the board.
+ *
+ * @param gameMap The game board.
+ * @param tile The coordinates of the tile.
+ * @return Mask with bits set for neighbors, that have Bug piece on them.
+ */
+inline neighborsMask GetOccupiedNeighborsMask(const HexGrid& gameMap, const HexCords& tile) {
+	int index = gameMap.GetIndexOfCords(tile);
+	return index == -1 ? GetOccupiedNeighborsMask<HexGrid>(gameMap, tile)
+	                   : gameMap.GetOccupiedNeighborsMaskAtIndex(index);
+}
+
+/**
+ * @brief Get the mask of empty neighbors of a tile.
+ *
+ * Reads the masks kept by the board, so it is O(1) for spaces of the board.
+ *
+ * @param gameMap The game board.
+ * @param tile The coordinates of the tile.
+ * @return Mask with bits set for neighbors, that are on the map and don't have any Bug piece on them.
+ */
+inline neighborsMask GetEmptyNeighborsMask(const HexGrid& gameMap, const HexCords& tile) {
+	int index = gameMap.GetIndexOfCords(tile);
+	return index == -1 ? GetEmptyNeighborsMask<HexGrid>(gameMap, tile)
+	                   : gameMap.GetOnMapNeighborsMaskAtIndex(index) & ~gameMap.GetOccupiedNeighborsMaskAtIndex(index);
+}
+
+#endif  // !HEX_GRID_H
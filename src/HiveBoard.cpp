@@ -0,0 +1,148 @@
+#include "HiveBoard.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
+HiveBoard::HiveBoard() {
+	slots.fill({ EMPTY_SLOT_KEY, NO_PIECE, 0 });
+	piecePositions.fill({ 0, 0 });
+	pieceUnderPiece.fill(NO_PIECE);
+	isPieceOnBoard.fill(false);
+}
+
+void HiveBoard::PlacePiece(pieceId piece, const HexCords& cords) {
+	RecenterIfNeeded(cords);
+	PushPiece(piece, cords);
+	isPieceOnBoard[piece] = true;
+	avaiblePieces[GetPlayerIdOfPiece(piece)][GetHandIndexOfPiece(piece)].second--;
+}
+
+pieceId HiveBoard::RemovePiece(const HexCords& cords) {
+	auto piece = PopPiece(cords);
+	isPieceOnBoard[piece] = false;
+	avaiblePieces[GetPlayerIdOfPiece(piece)][GetHandIndexOfPiece(piece)].second++;
+	return piece;
+}
+
+void HiveBoard::MovePiece(const HexCords& from, const HexCords& to) {
+	auto piece = PopPiece(from);
+	RecenterIfNeeded(to);
+	PushPiece(piece, to);
+}
+
+int HiveBoard::FindOrInsertSlot(std::uint32_t key) {
+	int slot = GetHomeSlot(key);
+	while (slots[slot].key != key && slots[slot].key != EMPTY_SLOT_KEY) {
+		slot = (slot + 1) & (HASH_CAPACITY - 1);
+	}
+	slots[slot].key = key;
+	return slot;
+}
+
+void HiveBoard::ToggleInNeighborsMasks(const HexCords& cords) {
+	for (int i = 0; i < SIZE_OF_AXIAL_VECTORS; i++) {
+		int slot = FindOrInsertSlot(PackCords(cords + AXIAL_DIRECTION_VECTORS[i] - origin));
+		// The space is neighbor of its neighbor in the opposite direction
+		slots[slot].occupiedNeighbors ^= (neighborsMask)(1 << GetOppositeDirection(i));
+		if (slots[slot].occupiedNeighbors == 0 && slots[slot].piece == NO_PIECE) {
+			EraseSlot(slot);
+		}
+	}
+}
+
+void HiveBoard::PushPiece(pieceId piece, const HexCords& cords) {
+	int slot = FindOrInsertSlot(PackCords(cords - origin));
+	pieceUnderPiece[piece] = slots[slot].piece;
+	slots[slot].piece = piece;
+	piecePositions[piece] = cords;
+	hash ^= GetZobristKey(piece, cords, pieceUnderPiece[piece]);
+	UpdateBitboards(cords - origin, piece);
+
+	if (pieceUnderPiece[piece] == NO_PIECE) {
+		occupiedTilesCount++;
+		ToggleInNeighborsMasks(cords);
+	}
+}
+
+pieceId HiveBoard::PopPiece(const HexCords& cords) {
+	auto key = PackCords(cords - origin);
+	int slot = FindSlot(key);
+	auto piece = slots[slot].piece;
+	slots[slot].piece = pieceUnderPiece[piece];
+	hash ^= GetZobristKey(piece, cords, pieceUnderPiece[piece]);
+	UpdateBitboards(cords - origin, pieceUnderPiece[piece]);
+
+	if (pieceUnderPiece[piece] == NO_PIECE) {
+		occupiedTilesCount--;
+		ToggleInNeighborsMasks(cords);
+		// Erasing of neighbors could shift the slot of the space
+		slot = FindSlot(key);
+		if (slots[slot].occupiedNeighbors == 0) {
+			EraseSlot(slot);
+		}
+	}
+	pieceUnderPiece[piece] = NO_PIECE;
+	return piece;
+}
+
+void HiveBoard::UpdateBitboards(const HexCords& relativeCords, pieceId piece) {
+	occupiedSpaces.Reset(relativeCords);
+	playerSpaces[0].Reset(relativeCords);
+	playerSpaces[1].Reset(relativeCords);
+	if (piece != NO_PIECE) {
+		occupiedSpaces.Set(relativeCords);
+		playerSpaces[GetPlayerIdOfPiece(piece)].Set(relativeCords);
+	}
+}
+
+void HiveBoard::EraseSlot(int slot) {
+	int hole = slot;
+	for (int next = (slot + 1) & (HASH_CAPACITY - 1); slots[next].key != EMPTY_SLOT_KEY;
+	     next = (next + 1) & (HASH_CAPACITY - 1)) {
+		// Entry can be moved back to the hole only if the hole lies between its home slot and its current slot
+		int home = GetHomeSlot(slots[next].key);
+		if (((next - home) & (HASH_CAPACITY - 1)) >= ((next - hole) & (HASH_CAPACITY - 1))) {
+			slots[hole] = slots[next];
+			hole = next;
+		}
+	}
+	slots[hole] = { EMPTY_SLOT_KEY, NO_PIECE, 0 };
+}
+
+void HiveBoard::RecenterIfNeeded(const HexCords& cords) {
+	auto relativeCords = cords - origin;
+	if (std::abs(relativeCords.q) < RECENTER_LIMIT && std::abs(relativeCords.r) < RECENTER_LIMIT) {
+		return;
+	}
+
+	// New origin is the middle of bounding box of the hive including the new space
+	HexCords minCords = cords, maxCords = cords;
+	ForEachOccupiedTile([&](const HexCords& tile, pieceId) {
+		minCords = { std::min(minCords.q, tile.q), std::min(minCords.r, tile.r) };
+		maxCords = { std::max(maxCords.q, tile.q), std::max(maxCords.r, tile.r) };
+	});
+	Recenter({ std::midpoint(minCords.q, maxCords.q), std::midpoint(minCords.r, maxCords.r) });
+}
+
+void HiveBoard::Recenter(const HexCords& newOrigin) {
+	auto oldSlots = slots;
+	auto oldOrigin = origin;
+	slots.fill({ EMPTY_SLOT_KEY, NO_PIECE, 0 });
+	occupiedSpaces.Clear();
+	playerSpaces[0].Clear();
+	playerSpaces[1].Clear();
+	origin = newOrigin;
+
+	for (const auto& oldSlot : oldSlots) {
+		if (oldSlot.key != EMPTY_SLOT_KEY) {
+			auto key = PackCords(UnpackCords(oldSlot.key) + oldOrigin - origin);
+			int slot = GetHomeSlot(key);
+			while (slots[slot].key != EMPTY_SLOT_KEY) {
+				slot = (slot + 1) & (HASH_CAPACITY - 1);
+			}
+			slots[slot] = { key, oldSlot.piece, oldSlot.occupiedNeighbors };
+			UpdateBitboards(UnpackCords(key), oldSlot.piece);
+		}
+	}
+}
@@ -0,0 +1,603 @@
+/**
+ * @file HiveBoard.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the unbounded game board used by the engine
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef HIVE_BOARD_H
+#define HIVE_BOARD_H
+
+#include "HexBitboard.h"
+#include "bugTiles.h"
+#include "common.h"
+#include "hexUtilities.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+/**
+ * @brief Move of one piece, placement from hand or movement on the board.
+ */
+struct Move {
+	pieceId piece = NO_PIECE; /**< The id of the moved piece, NO_PIECE for pass. */
+	bool isPlacement = false; /**< Flag indicating if the piece is placed from hand. */
+	HexCords from = { 0, 0 }; /**< The original coordinates of the piece, unused for placement. */
+	HexCords to = { 0, 0 };   /**< The destination coordinates of the piece. */
+
+	/**
+	 * @brief Equality operator.
+	 * @param other The other Move object to compare against.
+	 * @return True if both moves are the same, false otherwise.
+	 */
+	constexpr bool operator==(const Move& other) const = default;
+};
+
+/**
+ * @brief Game board without any bounds of coordinates.
+ *
+ * Only occupied spaces and their empty neighbors are stored. They live in open-addressing hash table keyed by packed
+ * 32-bit (q, r), so memory and lookup cost depend only on the number of pieces (at most PIECES_COUNT) and not on the
+ * size of the hive. Every stored space keeps mask of its occupied neighbors, so neighbor queries and checking of
+ * surrounded Queen are O(1).
+ *
+ * Occupied spaces and spaces controlled by each player (top piece of the space belongs to the player) are also kept in
+ * bitboards, from which border of the hive and placement targets are computed by dilation.
+ *
+ * Coordinates used by the public interface are never changed. Internally they are stored relative to origin, that
+ * is moved to the middle of the hive whenever some piece gets too close to the edge of the bitboard window (see
+ * Recenter). Connected hive always fits into the window, so no space is ever lost.
+ */
+class HiveBoard {
+public:
+	/**
+	 * @brief Constructs an empty HiveBoard object.
+	 */
+	HiveBoard();
+
+	/**
+	 * @brief Get the piece lying on top of the space.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return The id of the piece on top of the space or NO_PIECE for empty space.
+	 */
+	pieceId GetPieceAt(const HexCords& cords) const {
+		int slot = FindSlot(PackCords(cords - origin));
+		return slot == -1 ? NO_PIECE : slots[slot].piece;
+	}
+
+	/**
+	 * @brief Get the piece lying directly under the piece.
+	 *
+	 * @param piece The id of the piece.
+	 * @return The id of the piece under the piece or NO_PIECE if the piece lies on the ground.
+	 */
+	pieceId GetPieceUnder(pieceId piece) const { return pieceUnderPiece[piece]; }
+
+	/**
+	 * @brief Checks if the piece has been put on the board.
+	 *
+	 * @param piece The id of the piece.
+	 * @return True if the piece is on the board, false if it is still in player's hand.
+	 */
+	bool IsPieceOnBoard(pieceId piece) const { return isPieceOnBoard[piece]; }
+
+	/**
+	 * @brief Get the position of the piece.
+	 *
+	 * @param piece The id of the piece, that is on the board.
+	 * @return The coordinates of the space where the piece lies.
+	 */
+	const HexCords& GetPositionOfPiece(pieceId piece) const { return piecePositions[piece]; }
+
+	/**
+	 * @brief Get the mask of occupied neighbors of the space.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return neighborsMask
+	 */
+	neighborsMask GetOccupiedNeighborsMask(const HexCords& cords) const {
+		int slot = FindSlot(PackCords(cords - origin));
+		return slot == -1 ? 0 : slots[slot].occupiedNeighbors;
+	}
+
+	/**
+	 * @brief Get the number of occupied neighbors of the space.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return int
+	 */
+	int GetOccupiedNeighborsCount(const HexCords& cords) const { return std::popcount(GetOccupiedNeighborsMask(cords)); }
+
+	/**
+	 * @brief Checks if Queen of the player is surrounded on all sides.
+	 *
+	 * @param playerId The ID of the player.
+	 * @return True if the Queen is on the board and all its neighbors are occupied, false otherwise.
+	 */
+	bool IsQueenSurrounded(int playerId) const {
+		auto queen = MakePieceId(playerId, 0, 0);
+		return isPieceOnBoard[queen] && GetOccupiedNeighborsCount(piecePositions[queen]) == HEXAGON_SIDES_COUNT;
+	}
+
+	/**
+	 * @brief Get the number of occupied spaces.
+	 *
+	 * @return int
+	 */
+	int GetOccupiedTilesCount() const { return occupiedTilesCount; }
+
+	/**
+	 * @brief Get the hash of the position.
+	 *
+	 * Zobrist hash, that is XOR of keys of all pieces on the board, updated with every change of the board.
+	 *
+	 * @return std::uint64_t
+	 */
+	std::uint64_t GetHash() const { return hash; }
+
+	/**
+	 * @brief Get the key of the piece lying on the space for the hash of the position.
+	 *
+	 * @param piece The id of the piece.
+	 * @param cords The coordinates of the space.
+	 * @param pieceUnder The id of the piece under the piece, so Beetles on stacks get different keys.
+	 * @return Pseudorandom 64-bit key.
+	 */
+	static std::uint64_t GetZobristKey(pieceId piece, const HexCords& cords, pieceId pieceUnder) {
+		// SplitMix64 finalizer of the packed arguments
+		std::uint64_t key = piece | ((std::uint64_t)pieceUnder << 8) | ((std::uint64_t)(std::uint16_t)cords.q << 16) |
+		                    ((std::uint64_t)(std::uint16_t)cords.r << 32);
+		key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+		key = (key ^ (key >> 27)) * 0x94D049BB133111EBull;
+		return key ^ (key >> 31);
+	}
+
+	/**
+	 * @brief Get the border of the hive.
+	 *
+	 * @return Bitboard of empty spaces, that have atleast one occupied neighbor.
+	 */
+	HexBitboard GetBorderOfHive() const { return occupiedSpaces.Dilate() & ~occupiedSpaces; }
+
+	/**
+	 * @brief Get the spaces where the player can place piece from hand.
+	 *
+	 * Placed piece must touch some space of the player and must not touch any space of the opponent. Only exception is
+	 * the first piece of the second player, which can be placed anywhere next to the first piece. Placement of the first
+	 * piece of the game is left to the caller.
+	 *
+	 * @param playerId The ID of the player.
+	 * @return Bitboard of empty spaces, where the player can place piece.
+	 */
+	HexBitboard GetPlacementTargets(int playerId) const {
+		if (occupiedTilesCount == 1) {
+			return GetBorderOfHive();
+		}
+		return playerSpaces[playerId].Dilate() & ~playerSpaces[(playerId + 1) % 2].Dilate() & ~occupiedSpaces;
+	}
+
+	/**
+	 * @brief Checks if the player has some piece, that is not on the board.
+	 *
+	 * @param playerId The ID of the player.
+	 * @return True if some piece of the player is still in hand, false otherwise.
+	 */
+	bool HasPieceInHand(int playerId) const {
+		for (const auto& piece : avaiblePieces[playerId]) {
+			if (piece.second > 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Get the pieces in the hand of the player.
+	 *
+	 * Same layout as Player::GetPlayerAvaiblepieces, updated with every placement.
+	 *
+	 * @param playerId The ID of the player.
+	 * @return const std::array<playerPiece, DIFFERENT_PIECES_COUNT>&
+	 */
+	const std::array<playerPiece, DIFFERENT_PIECES_COUNT>& GetPlayerAvaiblepieces(int playerId) const {
+		return avaiblePieces[playerId];
+	}
+
+	/**
+	 * @brief Takes all pieces out of the hands of both players, so they never enter the game.
+	 *
+	 * Used for endgame positions with reduced material, where only pieces on the board take part in the game.
+	 */
+	void ClearHands() {
+		for (auto& hand : avaiblePieces) {
+			for (auto& piece : hand) {
+				piece.second = 0;
+			}
+		}
+	}
+
+	/**
+	 * @brief Checks if the space is in the bitboard obtained from this board.
+	 *
+	 * @param bitboard The bitboard returned by this board, it is invalidated by any change of the board.
+	 * @param cords The coordinates of the space.
+	 * @return True if the space is in the bitboard, false otherwise.
+	 */
+	bool IsSpaceIn(const HexBitboard& bitboard, const HexCords& cords) const {
+		auto relativeCords = cords - origin;
+		return relativeCords.q >= -HexBitboard::SIZE / 2 && relativeCords.q < HexBitboard::SIZE / 2 &&
+		       relativeCords.r >= -HexBitboard::SIZE / 2 && relativeCords.r < HexBitboard::SIZE / 2 &&
+		       bitboard.Test(relativeCords);
+	}
+
+	/**
+	 * @brief Calls function for every space in the bitboard obtained from this board.
+	 *
+	 * @param bitboard The bitboard returned by this board, it is invalidated by any change of the board.
+	 * @param function Callable taking coordinates of the space, it can stop the iteration by returning true.
+	 * @return True if the function stopped the iteration, false otherwise.
+	 */
+	template <typename Function>
+	bool ForEachSpaceIn(const HexBitboard& bitboard, Function&& function) const {
+		return bitboard.ForEachSpace(
+		    [&](const HexCords& relativeCords) { return CallAndCheckStop(function, relativeCords + origin); });
+	}
+
+	/**
+	 * @brief Puts piece from player's hand on the empty space.
+	 *
+	 * @param piece The id of the placed piece.
+	 * @param cords The coordinates of the space.
+	 */
+	void PlacePiece(pieceId piece, const HexCords& cords);
+
+	/**
+	 * @brief Takes the piece from the top of the space back to player's hand.
+	 *
+	 * Used to take back placement of the piece.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return The id of the removed piece.
+	 */
+	pieceId RemovePiece(const HexCords& cords);
+
+	/**
+	 * @brief Moves the piece from the top of one space on top of the other space.
+	 *
+	 * @param from The coordinates of the original space.
+	 * @param to The coordinates of the destination space.
+	 */
+	void MovePiece(const HexCords& from, const HexCords& to);
+
+	/**
+	 * @brief Plays the move.
+	 *
+	 * @param move The legal move, that is not pass.
+	 */
+	void MakeMove(const Move& move) {
+		if (move.isPlacement) {
+			PlacePiece(move.piece, move.to);
+		} else {
+			MovePiece(move.from, move.to);
+		}
+	}
+
+	/**
+	 * @brief Takes back the move played by MakeMove.
+	 *
+	 * @param move The last played move.
+	 */
+	void UndoMove(const Move& move) {
+		if (move.isPlacement) {
+			RemovePiece(move.to);
+		} else {
+			MovePiece(move.to, move.from);
+		}
+	}
+
+	/**
+	 * @brief Calls function for every occupied space of the board.
+	 *
+	 * @param function Callable taking coordinates of the space and id of the piece on top of it.
+	 */
+	template <typename Function>
+	void ForEachOccupiedTile(Function&& function) const {
+		for (const auto& slot : slots) {
+			if (slot.piece != NO_PIECE) {
+				function(piecePositions[slot.piece], slot.piece);
+			}
+		}
+	}
+
+private:
+	/**
+	 * @brief Slot of the hash table.
+	 */
+	struct hashSlot {
+		std::uint32_t key;               /**< Packed coordinates of the space relative to origin or EMPTY_SLOT_KEY. */
+		pieceId piece;                   /**< The id of the piece on top of the space or NO_PIECE. */
+		neighborsMask occupiedNeighbors; /**< Mask of occupied neighbors of the space. */
+	};
+
+	// Hive with all pieces has at most PIECES_COUNT occupied and 2 * PIECES_COUNT + 6 empty neighboring spaces
+	static constexpr int HASH_CAPACITY_BITS = 8;                  /**< Binary logarithm of HASH_CAPACITY. */
+	static constexpr int HASH_CAPACITY = 1 << HASH_CAPACITY_BITS; /**< Size of the hash table. */
+	static constexpr int RECENTER_LIMIT = HexBitboard::SIZE / 2 - 2; /**< Limit of relative coordinate of piece. */
+	static constexpr std::uint32_t EMPTY_SLOT_KEY = 0x80008000;   /**< Key of unused slot, it is never valid key. */
+
+	/**
+	 * @brief Packs coordinates relative to origin into the key of the hash table.
+	 *
+	 * @param relativeCords Coordinates relative to origin, both must fit into 16 bits.
+	 * @return The packed key.
+	 */
+	static std::uint32_t PackCords(const HexCords& relativeCords) {
+		return ((std::uint32_t)(std::uint16_t)relativeCords.q << 16) | (std::uint16_t)relativeCords.r;
+	}
+
+	/**
+	 * @brief Unpacks the key of the hash table into coordinates relative to origin.
+	 *
+	 * @param key The packed key.
+	 * @return Coordinates relative to origin.
+	 */
+	static HexCords UnpackCords(std::uint32_t key) { return { (std::int16_t)(key >> 16), (std::int16_t)key }; }
+
+	/**
+	 * @brief Get the preferred slot of the key.
+	 *
+	 * @param key The packed key.
+	 * @return Index of the first slot probed for the key.
+	 */
+	static int GetHomeSlot(std::uint32_t key) { return (int)((key * 0x9E3779B1u) >> (32 - HASH_CAPACITY_BITS)); }
+
+	/**
+	 * @brief Finds the slot of the key.
+	 *
+	 * @param key The packed key.
+	 * @return Index of the slot or -1 if the key isn't in the table.
+	 */
+	int FindSlot(std::uint32_t key) const {
+		for (int slot = GetHomeSlot(key);; slot = (slot + 1) & (HASH_CAPACITY - 1)) {
+			if (slots[slot].key == key) {
+				return slot;
+			}
+			if (slots[slot].key == EMPTY_SLOT_KEY) {
+				return -1;
+			}
+		}
+	}
+
+	/**
+	 * @brief Finds the slot of the key, inserting the key into the table if it isn't there.
+	 *
+	 * @param key The packed key.
+	 * @return Index of the slot.
+	 */
+	int FindOrInsertSlot(std::uint32_t key);
+
+	/**
+	 * @brief Flips the bit of the space in masks of all its neighbors.
+	 *
+	 * Neighbors are inserted into the table when they get their first occupied neighbor and erased when they are empty
+	 * and lose their last one.
+	 *
+	 * @param cords The coordinates of the space, that became occupied or empty.
+	 */
+	void ToggleInNeighborsMasks(const HexCords& cords);
+
+	/**
+	 * @brief Puts the piece on top of the space, inserting the space into the table if it isn't there.
+	 *
+	 * @param piece The id of the piece.
+	 * @param cords The coordinates of the space.
+	 */
+	void PushPiece(pieceId piece, const HexCords& cords);
+
+	/**
+	 * @brief Takes the piece from the top of the space, erasing the space from the table if it isn't needed anymore.
+	 *
+	 * @param cords The coordinates of the occupied space.
+	 * @return The id of the taken piece.
+	 */
+	pieceId PopPiece(const HexCords& cords);
+
+	/**
+	 * @brief Erases the slot from the table.
+	 *
+	 * Uses backward shift deletion, so no tombstones are left in the table.
+	 *
+	 * @param slot Index of the slot.
+	 */
+	void EraseSlot(int slot);
+
+	/**
+	 * @brief Updates bitboards of the space after the piece on top of it changed.
+	 *
+	 * @param relativeCords The coordinates of the space relative to origin.
+	 * @param piece The id of the piece on top of the space or NO_PIECE.
+	 */
+	void UpdateBitboards(const HexCords& relativeCords, pieceId piece);
+
+	/**
+	 * @brief Moves origin to the middle of the hive if the space is too far from it.
+	 *
+	 * @param cords The coordinates of the space, that is going to be occupied.
+	 */
+	void RecenterIfNeeded(const HexCords& cords);
+
+	/**
+	 * @brief Moves origin and rebuilds the hash table and bitboards.
+	 *
+	 * @param newOrigin The coordinates of the new origin.
+	 */
+	void Recenter(const HexCords& newOrigin);
+
+	std::array<hashSlot, HASH_CAPACITY> slots;         /**< The hash table of occupied and neighboring spaces. */
+	HexCords origin = { 0, 0 };                        /**< Origin of coordinates stored in the table. */
+	std::array<HexCords, PIECES_COUNT> piecePositions; /**< Position of every piece on the board. */
+	std::array<pieceId, PIECES_COUNT> pieceUnderPiece; /**< The id of the piece under each piece. */
+	std::array<bool, PIECES_COUNT> isPieceOnBoard;     /**< Flag for every piece if it is on the board. */
+	std::array<std::array<playerPiece, DIFFERENT_PIECES_COUNT>, 2> avaiblePieces = {
+		STARTING_PIECES, STARTING_PIECES
+	}; /**< Pieces in the hand of each player. */
+	int occupiedTilesCount = 0;                        /**< Number of occupied spaces. */
+	std::uint64_t hash = 0;                            /**< Zobrist hash of the position. */
+	HexBitboard occupiedSpaces;                        /**< Bitboard of occupied spaces. */
+	std::array<HexBitboard, 2> playerSpaces;           /**< Bitboard of spaces with piece of the player on top. */
+};
+
+/**
+ * @brief Get the piece lying on top of the space.
+ *
+ * @param gameMap The game board.
+ * @param cords The coordinates of the space.
+ * @return The id of the piece on top of the space or NO_PIECE if the space is empty.
+ */
+inline pieceId GetPieceAt(const HiveBoard& gameMap, const HexCords& cords) { return gameMap.GetPieceAt(cords); }
+
+/**
+ * @brief Checks if the space is part of the game board, which is always true for unbounded board.
+ *
+ * @param gameMap The game board.
+ * @param cords The coordinates of the space.
+ * @return true
+ */
+inline bool IsOnMap([[maybe_unused]] const HiveBoard& gameMap, [[maybe_unused]] const HexCords& cords) { return true; }
+
+/**
+ * @brief Get the number of occupied spaces of the game board.
+ *
+ * @param gameMap The game board.
+ * @return int
+ */
+inline int GetOccupiedTilesCount(const HiveBoard& gameMap) { return gameMap.GetOccupiedTilesCount(); }
+
+/**
+ * @brief Calls function for every occupied space of the game board.
+ *
+ * @param gameMap The game board.
+ * @param function Callable taking coordinates of the space and id of the piece on top of it.
+ */
+template <typename Function>
+void ForEachOccupiedTile(const HiveBoard& gameMap, Function&& function) {
+	gameMap.ForEachOccupiedTile(function);
+}
+
+/**
+ * @brief Get the mask of occupied neighbors of a tile.
+ *
+ * Reads the mask kept by the board, so it is O(1).
+ *
+ * @param gameMap The game board.
+ * @param tile The coordinates of the tile.
+ * @return Mask with bits set for neighbors, that have Bug piece on them.
+ */
+inline neighborsMask GetOccupiedNeighborsMask(const HiveBoard& gameMap, const HexCords& tile) {
+	return gameMap.GetOccupiedNeighborsMask(tile);
+}
+
+/**
+ * @brief Get the mask of empty neighbors of a tile.
+ *
+ * Reads the mask kept by the board, so it is O(1).
+ *
+ * @param gameMap The game board.
+ * @param tile The coordinates of the tile.
+ * @return Mask with bits set for neighbors, that don't have any Bug piece on them.
+ */
+inline neighborsMask GetEmptyNeighborsMask(const HiveBoard& gameMap, const HexCords& tile) {
+	return ALL_NEIGHBORS_MASK & ~gameMap.GetOccupiedNeighborsMask(tile);
+}
+
+/**
+ * @brief Define rules for placing the bug tile.
+ *
+ * Reports possible places to place the bug tile from player hand, see HiveBoard::GetPlacementTargets.
+ *
+ * @param gameMap The game board.
+ * @param IDOfPlayer The ID of the player placing the bug tile.
+ * @param emit Callable receiving the possible places, it can stop the generation by returning true.
+ * @return True if emit stopped the generation, false otherwise.
+ */
+template <typename Emit>
+bool GeneratePlacements(const HiveBoard& gameMap, const int IDOfPlayer, Emit&& emit) {
+	TRACE_SCOPE("GeneratePlacements");
+	return gameMap.ForEachSpaceIn(gameMap.GetPlacementTargets(IDOfPlayer), emit);
+}
+
+/**
+ * @brief Calls function for every piece the player can place from hand now.
+ *
+ * Only the next piece of every bug type in hand is reported, because pieces of the same type are interchangeable.
+ * Queen must be placed atleast as the fourth piece of the player, so then only Queen is reported.
+ *
+ * @param gameMap The game board.
+ * @param IDOfPlayer The ID of the player.
+ * @param function Callable taking the id of the piece, it can stop the iteration by returning true.
+ * @return True if the function stopped the iteration, false otherwise.
+ */
+template <typename Function>
+bool ForEachPlaceablePiece(const HiveBoard& gameMap, const int IDOfPlayer, Function&& function) {
+	int placedPiecesCount = 0;
+	for (int i = 0; i < PIECES_PER_PLAYER; i++) {
+		placedPiecesCount += gameMap.IsPieceOnBoard((pieceId)(IDOfPlayer * PIECES_PER_PLAYER + i));
+	}
+	bool mustPlaceQueen = placedPiecesCount == 3 && !gameMap.IsPieceOnBoard(MakePieceId(IDOfPlayer, 0, 0));
+
+	for (int handIndex = 0; handIndex < (mustPlaceQueen ? 1 : DIFFERENT_PIECES_COUNT); handIndex++) {
+		for (int ordinal = 0; ordinal < STARTING_PIECES[handIndex].second; ordinal++) {
+			auto piece = MakePieceId(IDOfPlayer, handIndex, ordinal);
+			if (!gameMap.IsPieceOnBoard(piece)) {
+				if (CallAndCheckStop(function, piece)) {
+					return true;
+				}
+				break;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Checks if the player can make atleast one move.
+ *
+ * Stops at the first legal placement or movement, so it is much cheaper than generating all moves.
+ *
+ * @param hiveBoard The game board.
+ * @param IDOfPlayer The ID of the player.
+ * @return True if the player has some legal move, false if they have to pass.
+ */
+inline bool HasAnyLegalMove(const HiveBoard& hiveBoard, const int IDOfPlayer) {
+	auto stop = []([[maybe_unused]] const HexCords& cords) { return true; };
+
+	if (hiveBoard.HasPieceInHand(IDOfPlayer)) {
+		if (hiveBoard.GetOccupiedTilesCount() == 0 || GeneratePlacements(hiveBoard, IDOfPlayer, stop)) {
+			return true;
+		}
+	}
+
+	// Pieces can move only after their Queen has been placed
+	if (!hiveBoard.IsPieceOnBoard(MakePieceId(IDOfPlayer, 0, 0))) {
+		return false;
+	}
+	for (int i = 0; i < PIECES_PER_PLAYER; i++) {
+		auto piece = (pieceId)(IDOfPlayer * PIECES_PER_PLAYER + i);
+		if (!hiveBoard.IsPieceOnBoard(piece)) {
+			continue;
+		}
+		const auto& cords = hiveBoard.GetPositionOfPiece(piece);
+		if (hiveBoard.GetPieceAt(cords) == piece &&
+		    GenerateMoves(hiveBoard, piece, cords, hiveBoard.GetPieceUnder(piece) != NO_PIECE, stop)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+#endif  // !HIVE_BOARD_H
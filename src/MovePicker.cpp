@@ -0,0 +1,234 @@
+#include "MovePicker.h"
+#include "Trace.h"
+
+#include <algorithm>
+
+MovePicker::MovePicker(const HiveBoard& gameMap, int IDOfPlayer, const Move& hashMove, const killerMoves& killers,
+                       const MoveHistory& history, Buffers& buffers)
+    : gameMap(gameMap), IDOfPlayer(IDOfPlayer), hashMove(hashMove), killers(killers), history(history),
+      moves(buffers.moves), movements(buffers.movements) {
+	moves.clear();
+	movements.clear();
+	auto opponentQueen = MakePieceId((IDOfPlayer + 1) % 2, 0, 0);
+	isOpponentQueenOnBoard = gameMap.IsPieceOnBoard(opponentQueen);
+	if (isOpponentQueenOnBoard) {
+		opponentQueenCords = gameMap.GetPositionOfPiece(opponentQueen);
+	}
+	auto ownQueen = MakePieceId(IDOfPlayer, 0, 0);
+	canMovePieces = gameMap.IsPieceOnBoard(ownQueen);
+	if (canMovePieces) {
+		ownQueenCords = gameMap.GetPositionOfPiece(ownQueen);
+	}
+	movementsBegin.fill(-1);
+	movementsEnd.fill(-1);
+	if (this->killers[1] == this->killers[0]) {
+		this->killers[1] = Move();
+	}
+}
+
+bool MovePicker::Next(Move& move) {
+	switch (stage) {
+		case Stage::HASH_MOVE:
+			stage = Stage::QUEEN_PRESSURE_INIT;
+			if (hashMove.piece != NO_PIECE && IsLegal(hashMove)) {
+				move = hashMove;
+				return true;
+			}
+			// Illegal hash move must not be skipped in later stages
+			hashMove = Move();
+			[[fallthrough]];
+
+		case Stage::QUEEN_PRESSURE_INIT:
+			// Placed piece never touches the opponent nor leaves a space, so only movements have positive priority
+			if (canMovePieces) {
+				for (int i = 0; i < PIECES_PER_PLAYER; i++) {
+					auto piece = (pieceId)(IDOfPlayer * PIECES_PER_PLAYER + i);
+					if ((isOpponentQueenOnBoard && CanReachOpponentQueen(piece)) || CanFreeOwnQueen(piece)) {
+						GenerateMovementsOfPiece(i);
+						for (int j = movementsBegin[i]; j < movementsEnd[i]; j++) {
+							if (movements[j].priority > 0) {
+								moves.push_back(movements[j]);
+							}
+						}
+					}
+				}
+				SortMoves(moves.begin(), moves.end());
+			}
+			stage = Stage::QUEEN_PRESSURE;
+			[[fallthrough]];
+
+		case Stage::QUEEN_PRESSURE:
+			while (nextMove < moves.size()) {
+				move = moves[nextMove++].move;
+				if (move != hashMove) {
+					return true;
+				}
+			}
+			stage = Stage::KILLERS;
+			[[fallthrough]];
+
+		case Stage::KILLERS:
+			while (killerIndex < (int)killers.size()) {
+				auto& killer = killers[killerIndex++];
+				// Killers with positive priority have already been returned in the Queen stage
+				if (killer.piece != NO_PIECE && killer != hashMove && IsLegal(killer) && GetQueenPriority(killer) <= 0) {
+					move = killer;
+					return true;
+				}
+				// Killer, that hasn't been returned, must not be skipped in later stages
+				killer = Move();
+			}
+			stage = Stage::PLACEMENTS_INIT;
+			[[fallthrough]];
+
+		case Stage::PLACEMENTS_INIT:
+			moves.clear();
+			nextMove = 0;
+			if (gameMap.HasPieceInHand(IDOfPlayer)) {
+				TRACE_SCOPE("MovePicker::GeneratePlacements");
+				auto targets = gameMap.GetPlacementTargets(IDOfPlayer);
+				bool isBoardEmpty = gameMap.GetOccupiedTilesCount() == 0;
+				ForEachPlaceablePiece(gameMap, IDOfPlayer, [&](pieceId piece) {
+					if (isBoardEmpty) {
+						moves.push_back(ScoreMove({ piece, true, { 0, 0 }, { 0, 0 } }));
+					}
+					gameMap.ForEachSpaceIn(targets, [&](const HexCords& cords) {
+						moves.push_back(ScoreMove({ piece, true, { 0, 0 }, cords }));
+					});
+				});
+				SortMoves(moves.begin(), moves.end());
+			}
+			stage = Stage::PLACEMENTS;
+			[[fallthrough]];
+
+		case Stage::PLACEMENTS:
+			while (nextMove < moves.size()) {
+				move = moves[nextMove++].move;
+				if (!IsReturnedEarly(move)) {
+					return true;
+				}
+			}
+			stage = canMovePieces ? Stage::MOVEMENTS : Stage::DONE;
+			[[fallthrough]];
+
+		case Stage::MOVEMENTS:
+			while (stage == Stage::MOVEMENTS) {
+				if (movementPieceIndex != -1) {
+					while (nextMove < (size_t)movementsEnd[movementPieceIndex]) {
+						const auto& movement = movements[nextMove++];
+						if (movement.priority <= 0 && !IsReturnedEarly(movement.move)) {
+							move = movement.move;
+							return true;
+						}
+					}
+				}
+
+				// Find the next piece of the current bug type, or the first piece of the next bug type
+				do {
+					movementPieceIndex++;
+					if (movementPieceIndex == PIECES_PER_PLAYER) {
+						movementPieceIndex = 0;
+						movementTypeIndex++;
+					}
+				} while (movementTypeIndex < DIFFERENT_PIECES_COUNT &&
+				         GetBugTypeOfPiece((pieceId)(IDOfPlayer * PIECES_PER_PLAYER + movementPieceIndex)) !=
+				             MOVEMENT_ORDER[movementTypeIndex]);
+
+				if (movementTypeIndex == DIFFERENT_PIECES_COUNT) {
+					stage = Stage::DONE;
+				} else {
+					GenerateMovementsOfPiece(movementPieceIndex);
+					nextMove = movementsBegin[movementPieceIndex];
+				}
+			}
+			[[fallthrough]];
+
+		case Stage::DONE:
+			return false;
+	}
+	return false;
+}
+
+bool MovePicker::IsLegal(const Move& move) const {
+	if (GetPlayerIdOfPiece(move.piece) != IDOfPlayer) {
+		return false;
+	}
+
+	if (move.isPlacement) {
+		bool isPlaceable = ForEachPlaceablePiece(gameMap, IDOfPlayer, [&](pieceId piece) { return piece == move.piece; });
+		if (gameMap.GetOccupiedTilesCount() == 0) {
+			return isPlaceable && move.to == HexCords(0, 0);
+		}
+		return isPlaceable && gameMap.IsSpaceIn(gameMap.GetPlacementTargets(IDOfPlayer), move.to);
+	}
+
+	if (!canMovePieces || !IsMovablePiece(move.piece) || gameMap.GetPositionOfPiece(move.piece) != move.from) {
+		return false;
+	}
+	return GenerateMoves(gameMap, move.piece, move.from, gameMap.GetPieceUnder(move.piece) != NO_PIECE,
+	                     [&](const HexCords& cords) { return cords == move.to; });
+}
+
+int MovePicker::GetQueenPriority(const Move& move) const {
+	if (move.isPlacement) {
+		return IsNextToOwnQueen(move.to) ? -1 : 0;
+	}
+
+	int priority = 0;
+	if (IsNextToOpponentQueen(move.to) && !IsNextToOpponentQueen(move.from)) {
+		priority += 2;
+	}
+	if (move.piece == MakePieceId(IDOfPlayer, 0, 0)) {
+		// Queen moves by one space, so its old space is counted among the neighbors of the new one
+		int neighborsAfter = GetOccupiedNeighborsCount(gameMap, move.to) - 1;
+		priority += neighborsAfter < GetOccupiedNeighborsCount(gameMap, move.from) ? 1 : 0;
+	} else if (IsNextToOwnQueen(move.from) && !IsNextToOwnQueen(move.to)) {
+		priority += 1;
+	} else if (!IsNextToOwnQueen(move.from) && IsNextToOwnQueen(move.to)) {
+		priority -= 1;
+	}
+	return priority;
+}
+
+void MovePicker::SortMoves(std::vector<scoredMove>::iterator begin, std::vector<scoredMove>::iterator end) {
+	std::stable_sort(begin, end, [](const scoredMove& first, const scoredMove& second) {
+		return first.score > second.score;
+	});
+}
+
+bool MovePicker::CanReachOpponentQueen(pieceId piece) const {
+	if (!IsMovablePiece(piece)) {
+		return false;
+	}
+
+	int distance = GetDistance(gameMap.GetPositionOfPiece(piece), opponentQueenCords);
+	switch (GetBugTypeOfPiece(piece)) {
+		case bugType::QUEEN_BEE:
+		case bugType::BEETLE:
+			return distance <= 2;
+		case bugType::SPIDER:
+			return distance <= 4;
+		case bugType::GRASS_HOPPER:
+		case bugType::SOLDIER_ANT:
+			return true;
+	}
+	return true;
+}
+
+void MovePicker::GenerateMovementsOfPiece(int index) {
+	if (movementsBegin[index] != -1) {
+		return;
+	}
+	TRACE_SCOPE("MovePicker::GenerateMovementsOfPiece");
+
+	auto piece = (pieceId)(IDOfPlayer * PIECES_PER_PLAYER + index);
+	movementsBegin[index] = (int)movements.size();
+	if (IsMovablePiece(piece)) {
+		const auto& cords = gameMap.GetPositionOfPiece(piece);
+		GenerateMoves(gameMap, piece, cords, gameMap.GetPieceUnder(piece) != NO_PIECE, [&](const HexCords& destination) {
+			movements.push_back(ScoreMove({ piece, false, cords, destination }));
+		});
+	}
+	movementsEnd[index] = (int)movements.size();
+	SortMoves(movements.begin() + movementsBegin[index], movements.end());
+}
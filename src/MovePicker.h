@@ -0,0 +1,298 @@
+/**
+ * @file MovePicker.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the staged move generator used by the search
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MOVE_PICKER_H
+#define MOVE_PICKER_H
+
+#include "HiveBoard.h"
+#include "bugTiles.h"
+#include "common.h"
+#include "hexUtilities.h"
+
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+using killerMoves = std::array<Move, 2>; /**< Moves which caused cutoff in other nodes of the same ply. */
+
+/**
+ * @brief Butterfly history of moves which caused cutoffs, indexed by the piece and its destination.
+ *
+ * Destinations are taken modulo SIZE in both coordinates, hive is always smaller than that, so collisions are rare and
+ * they only make the ordering slightly worse.
+ */
+class MoveHistory {
+public:
+	static constexpr int SIZE = 32;          /**< Number of distinct values of each coordinate of the destination. */
+	static constexpr int MAX_SCORE = 1 << 14; /**< Bound of the absolute value of every score. */
+
+	/**
+	 * @brief Get the history score of the move.
+	 *
+	 * @param move The move.
+	 * @return int
+	 */
+	int Get(const Move& move) const { return scores[move.piece][GetIndex(move.to)]; }
+
+	/**
+	 * @brief Adds bonus to the score of the move.
+	 *
+	 * Score is pulled back towards zero proportionally to its size, so it never leaves [-MAX_SCORE, MAX_SCORE].
+	 *
+	 * @param move The move.
+	 * @param bonus The bonus, its absolute value must be atmost MAX_SCORE.
+	 */
+	void Add(const Move& move, int bonus) {
+		int& score = scores[move.piece][GetIndex(move.to)];
+		score += bonus - score * std::abs(bonus) / MAX_SCORE;
+	}
+
+	/**
+	 * @brief Halves all scores, so the history of previous searches matters less.
+	 */
+	void Age() {
+		for (auto& pieceScores : scores) {
+			for (auto& score : pieceScores) {
+				score /= 2;
+			}
+		}
+	}
+
+	/**
+	 * @brief Sets all scores to zero.
+	 */
+	void Clear() { scores = {}; }
+
+private:
+	/**
+	 * @brief Get the index of the destination.
+	 *
+	 * @param cords The coordinates of the destination.
+	 * @return int
+	 */
+	static int GetIndex(const HexCords& cords) { return (cords.q & (SIZE - 1)) * SIZE + (cords.r & (SIZE - 1)); }
+
+	std::array<std::array<int, SIZE * SIZE>, PIECES_COUNT> scores = {}; /**< Score of every piece and destination. */
+};
+
+/**
+ * @brief Generates moves of the player lazily, one move at a time.
+ *
+ * Moves are returned in stages: hash move, moves adding pressure to the opponent's Queen or freeing own Queen, killer
+ * moves, placements and then movements ordered by bug type. Each stage is generated only when the previous one is
+ * exhausted and moves of every piece are generated at most once, so when the search cuts off after first few moves,
+ * the rest is never generated. Inside of every stage moves are ordered by the Queen priority and history.
+ *
+ * The board must not change while the picker is used, except for moves made and taken back between calls of Next.
+ * Generated moves are kept in Buffers owned by the caller, so the picker itself never allocates.
+ */
+class MovePicker {
+	/**
+	 * @brief Move with the keys of its ordering.
+	 */
+	struct scoredMove {
+		Move move;    /**< The move. */
+		int priority; /**< The Queen priority of the move, positive moves are returned in the Queen stage. */
+		int score;    /**< The key of the ordering inside of the stage, higher is returned first. */
+	};
+
+public:
+	/**
+	 * @brief Storage of generated moves, reused by the pickers of one ply.
+	 *
+	 * Vectors keep their capacity, so they stop allocating once they have grown to the largest node. Buffers can be
+	 * used only by one picker at a time.
+	 */
+	class Buffers {
+		friend class MovePicker;
+
+		std::vector<scoredMove> moves;     /**< Moves of the Queen and placement stages. */
+		std::vector<scoredMove> movements; /**< Movements of all pieces generated so far. */
+	};
+
+	/**
+	 * @brief Constructs a new MovePicker object.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param hashMove Move from the transposition table, that is tried first if it is legal (piece NO_PIECE if none).
+	 * @param killers Killer moves of the ply, they are tried after the Queen stage if they are legal. Repeated killer
+	 *                is tried once.
+	 * @param history History of the search, it must outlive the picker.
+	 * @param buffers Storage of the generated moves, it must outlive the picker.
+	 */
+	MovePicker(const HiveBoard& gameMap, int IDOfPlayer, const Move& hashMove, const killerMoves& killers,
+	           const MoveHistory& history, Buffers& buffers);
+
+	/**
+	 * @brief Get the next move.
+	 *
+	 * @param move The next move, valid only if true is returned.
+	 * @return True if there was another move, false if all moves have been returned.
+	 */
+	bool Next(Move& move);
+
+private:
+	/**
+	 * @brief Stages of the generation, in the order in which they are processed.
+	 */
+	enum class Stage {
+		HASH_MOVE,           /**< The move from the transposition table. */
+		QUEEN_PRESSURE_INIT, /**< Generating moves with positive Queen priority. */
+		QUEEN_PRESSURE,      /**< Returning moves with positive Queen priority. */
+		KILLERS,             /**< The killer moves. */
+		PLACEMENTS_INIT,     /**< Generating placements. */
+		PLACEMENTS,          /**< Returning placements. */
+		MOVEMENTS,           /**< Generating and returning movements piece by piece. */
+		DONE                 /**< All moves have been returned. */
+	};
+
+	static constexpr int PRIORITY_WEIGHT = 4 * MoveHistory::MAX_SCORE; /**< Priority outweighs any history score. */
+
+	/**
+	 * @brief Order of bug types in the movement stage, cheap generators first.
+	 */
+	static constexpr std::array<bugType, DIFFERENT_PIECES_COUNT> MOVEMENT_ORDER = {
+		bugType::QUEEN_BEE, bugType::BEETLE, bugType::GRASS_HOPPER, bugType::SPIDER, bugType::SOLDIER_ANT
+	};
+
+	/**
+	 * @brief Checks if the move from the transposition table or killer slot is legal in the position.
+	 *
+	 * @param move The move, that is not pass.
+	 * @return True if the move is legal, false otherwise.
+	 */
+	bool IsLegal(const Move& move) const;
+
+	/**
+	 * @brief Checks if the space is next to the opponent's Queen.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return True if the opponent's Queen is on the board and the space is its neighbor, false otherwise.
+	 */
+	bool IsNextToOpponentQueen(const HexCords& cords) const {
+		return isOpponentQueenOnBoard && GetDistance(cords, opponentQueenCords) == 1;
+	}
+
+	/**
+	 * @brief Checks if the space is next to the player's Queen.
+	 *
+	 * @param cords The coordinates of the space.
+	 * @return True if the player's Queen is on the board and the space is its neighbor, false otherwise.
+	 */
+	bool IsNextToOwnQueen(const HexCords& cords) const {
+		return canMovePieces && GetDistance(cords, ownQueenCords) == 1;
+	}
+
+	/**
+	 * @brief Get the static priority of the move based on the neighborhoods of both Queens.
+	 *
+	 * Moving into the neighborhood of the opponent's Queen is worth 2, leaving the neighborhood of own Queen or moving
+	 * own Queen to less crowded space is worth 1 and entering the neighborhood of own Queen costs 1.
+	 *
+	 * @param move The legal move.
+	 * @return int
+	 */
+	int GetQueenPriority(const Move& move) const;
+
+	/**
+	 * @brief Checks if the piece is own Queen or neighbor of own Queen, so its movements can free the Queen.
+	 *
+	 * @param piece The id of the piece.
+	 * @return True if the piece is movable and can free own Queen, false otherwise.
+	 */
+	bool CanFreeOwnQueen(pieceId piece) const {
+		if (!IsMovablePiece(piece)) {
+			return false;
+		}
+		const auto& cords = gameMap.GetPositionOfPiece(piece);
+		return cords == ownQueenCords || IsNextToOwnQueen(cords);
+	}
+
+	/**
+	 * @brief Checks if the move has already been returned by the hash move or killer stage.
+	 *
+	 * @param move The move.
+	 * @return True if the move has been returned, false otherwise.
+	 */
+	bool IsReturnedEarly(const Move& move) const {
+		return move == hashMove || move == killers[0] || move == killers[1];
+	}
+
+	/**
+	 * @brief Computes the priority and the score of the move.
+	 *
+	 * @param move The legal move.
+	 * @return scoredMove
+	 */
+	scoredMove ScoreMove(const Move& move) const {
+		int priority = GetQueenPriority(move);
+		return { move, priority, priority * PRIORITY_WEIGHT + history.Get(move) };
+	}
+
+	/**
+	 * @brief Sorts the moves from the highest score.
+	 *
+	 * @param begin The first move.
+	 * @param end Behind the last move.
+	 */
+	static void SortMoves(std::vector<scoredMove>::iterator begin, std::vector<scoredMove>::iterator end);
+
+	/**
+	 * @brief Checks if the piece can move on the top of the board.
+	 *
+	 * @param piece The id of the piece.
+	 * @return True if the piece is on the board and nothing lies on top of it, false otherwise.
+	 */
+	bool IsMovablePiece(pieceId piece) const {
+		return gameMap.IsPieceOnBoard(piece) && gameMap.GetPieceAt(gameMap.GetPositionOfPiece(piece)) == piece;
+	}
+
+	/**
+	 * @brief Checks if the piece can possibly get next to the opponent's Queen in one move.
+	 *
+	 * Cheap upper bound based on distance, so pieces far from the Queen aren't generated in the Queen stage.
+	 *
+	 * @param piece The id of the piece.
+	 * @return False if the piece surely can't get next to the Queen, true otherwise.
+	 */
+	bool CanReachOpponentQueen(pieceId piece) const;
+
+	/**
+	 * @brief Generates movements of the piece into the buffer sorted by score, if they haven't been generated yet.
+	 *
+	 * @param index Index of the piece among the pieces of the player.
+	 */
+	void GenerateMovementsOfPiece(int index);
+
+	const HiveBoard& gameMap;       /**< The game board. */
+	int IDOfPlayer;                 /**< The ID of the player on turn. */
+	Move hashMove;                  /**< The move from the transposition table. */
+	killerMoves killers;            /**< The killer moves, illegal and repeated ones are replaced by pass. */
+	const MoveHistory& history;     /**< The history of the search. */
+	Stage stage = Stage::HASH_MOVE; /**< The current stage. */
+	int killerIndex = 0;            /**< Index of the next killer move. */
+
+	bool isOpponentQueenOnBoard = false;    /**< Flag indicating if the opponent's Queen has been placed. */
+	HexCords opponentQueenCords = { 0, 0 }; /**< Position of the opponent's Queen. */
+	bool canMovePieces = false;             /**< Flag indicating if the player's Queen has been placed. */
+	HexCords ownQueenCords = { 0, 0 };      /**< Position of the player's Queen. */
+
+	std::vector<scoredMove>& moves; /**< Moves of the Queen and placement stages. */
+	size_t nextMove = 0;            /**< Index of the next returned move of the current stage. */
+
+	std::vector<scoredMove>& movements;                /**< Movements of all pieces generated so far. */
+	std::array<int, PIECES_PER_PLAYER> movementsBegin; /**< Index of the first movement of each piece or -1. */
+	std::array<int, PIECES_PER_PLAYER> movementsEnd;   /**< Index behind the last movement of each piece. */
+	int movementTypeIndex = 0;                         /**< Index into MOVEMENT_ORDER in the movement stage. */
+	int movementPieceIndex = -1;                       /**< Index of the piece in the movement stage. */
+};
+
+#endif  // !MOVE_PICKER_H
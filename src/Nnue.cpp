@@ -0,0 +1,176 @@
+#include "Nnue.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#	include <immintrin.h>
+#elif defined(__SSE2__)
+#	include <emmintrin.h>
+#endif
+
+void NnueNetwork::ApplyFeaturesScalar(const std::int16_t* input, const std::int16_t* removed,
+                                      const std::int16_t* added, std::int16_t* output) {
+	for (int i = 0; i < HIDDEN_SIZE; i++) {
+		int value = input[i];
+		if (removed != nullptr) {
+			value -= removed[i];
+		}
+		if (added != nullptr) {
+			value += added[i];
+		}
+		output[i] = (std::int16_t)value;
+	}
+}
+
+void NnueNetwork::ApplyFeatures(const std::int16_t* input, const std::int16_t* removed, const std::int16_t* added,
+                                std::int16_t* output) {
+#if defined(__AVX2__)
+	for (int i = 0; i < HIDDEN_SIZE; i += 16) {
+		auto value = _mm256_load_si256((const __m256i*)(input + i));
+		if (removed != nullptr) {
+			value = _mm256_sub_epi16(value, _mm256_loadu_si256((const __m256i*)(removed + i)));
+		}
+		if (added != nullptr) {
+			value = _mm256_add_epi16(value, _mm256_loadu_si256((const __m256i*)(added + i)));
+		}
+		_mm256_store_si256((__m256i*)(output + i), value);
+	}
+#elif defined(__SSE2__)
+	for (int i = 0; i < HIDDEN_SIZE; i += 8) {
+		auto value = _mm_load_si128((const __m128i*)(input + i));
+		if (removed != nullptr) {
+			value = _mm_sub_epi16(value, _mm_loadu_si128((const __m128i*)(removed + i)));
+		}
+		if (added != nullptr) {
+			value = _mm_add_epi16(value, _mm_loadu_si128((const __m128i*)(added + i)));
+		}
+		_mm_store_si128((__m128i*)(output + i), value);
+	}
+#else
+	ApplyFeaturesScalar(input, removed, added, output);
+#endif
+}
+
+std::int32_t NnueNetwork::DotClippedViewScalar(const std::int16_t* values, const std::int16_t* weights) {
+	std::int32_t sum = 0;
+	for (int i = 0; i < HIDDEN_SIZE; i++) {
+		sum += std::clamp((int)values[i], 0, ACTIVATION_LIMIT) * weights[i];
+	}
+	return sum;
+}
+
+std::int32_t NnueNetwork::DotClippedView(const std::int16_t* values, const std::int16_t* weights) {
+#if defined(__AVX2__)
+	auto zero = _mm256_setzero_si256();
+	auto limit = _mm256_set1_epi16(ACTIVATION_LIMIT);
+	auto sum = _mm256_setzero_si256();
+	for (int i = 0; i < HIDDEN_SIZE; i += 16) {
+		auto value = _mm256_load_si256((const __m256i*)(values + i));
+		value = _mm256_min_epi16(_mm256_max_epi16(value, zero), limit);
+		sum = _mm256_add_epi32(sum, _mm256_madd_epi16(value, _mm256_load_si256((const __m256i*)(weights + i))));
+	}
+	auto half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+	half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+	half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+	return _mm_cvtsi128_si32(half);
+#elif defined(__SSE2__)
+	auto zero = _mm_setzero_si128();
+	auto limit = _mm_set1_epi16(ACTIVATION_LIMIT);
+	auto sum = _mm_setzero_si128();
+	for (int i = 0; i < HIDDEN_SIZE; i += 8) {
+		auto value = _mm_load_si128((const __m128i*)(values + i));
+		value = _mm_min_epi16(_mm_max_epi16(value, zero), limit);
+		sum = _mm_add_epi32(sum, _mm_madd_epi16(value, _mm_load_si128((const __m128i*)(weights + i))));
+	}
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+	return _mm_cvtsi128_si32(sum);
+#else
+	return DotClippedViewScalar(values, weights);
+#endif
+}
+
+void NnueNetwork::LoadFromFile(const std::string& path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Can't open network weights file " + path);
+	}
+
+	std::array<std::uint32_t, 4> header;
+	file.read((char*)header.data(), sizeof(header));
+	if (!file || header[0] != FILE_MAGIC || header[1] != FILE_VERSION || header[2] != HIDDEN_SIZE ||
+	    header[3] != FEATURES_COUNT) {
+		throw std::runtime_error("Network weights file " + path + " doesn't match the network");
+	}
+
+	std::vector<std::int16_t> weights((size_t)FEATURES_COUNT * HIDDEN_SIZE);
+	file.read((char*)featureBiases.data(), sizeof(featureBiases));
+	file.read((char*)weights.data(), (std::streamsize)(weights.size() * sizeof(std::int16_t)));
+	file.read((char*)outputWeights.data(), sizeof(outputWeights));
+	file.read((char*)&outputBias, sizeof(outputBias));
+	if (!file) {
+		throw std::runtime_error("Network weights file " + path + " is truncated");
+	}
+	featureWeights = std::move(weights);
+}
+
+void NnueNetwork::Refresh(const HiveBoard& gameMap, nnueAccumulator& accumulator) const {
+	RefreshView(gameMap, 0, accumulator);
+	RefreshView(gameMap, 1, accumulator);
+}
+
+void NnueNetwork::RefreshView(const HiveBoard& gameMap, int perspective, nnueAccumulator& accumulator) const {
+	auto& values = accumulator.values[perspective];
+	auto anchor = GetAnchor(gameMap, perspective);
+	accumulator.anchors[perspective] = anchor;
+	std::copy(featureBiases.begin(), featureBiases.end(), values.begin());
+	for (int piece = 0; piece < PIECES_COUNT; piece++) {
+		if (gameMap.IsPieceOnBoard((pieceId)piece)) {
+			int feature = GetFeatureIndex(perspective, anchor, (pieceId)piece,
+			                              gameMap.GetPositionOfPiece((pieceId)piece), GetHeight(gameMap, (pieceId)piece));
+			ApplyFeatures(values.data(), nullptr, GetFeatureWeights(feature), values.data());
+		}
+	}
+}
+
+void NnueNetwork::Update(const HiveBoard& gameMap, const Move& move, const nnueAccumulator& previous,
+                         nnueAccumulator& accumulator) const {
+	if (move.piece == NO_PIECE) {
+		accumulator = previous;
+		return;
+	}
+
+	int heightAfter = GetHeight(gameMap, move.piece);
+	int heightBefore = 0;
+	if (!move.isPlacement) {
+		// Pieces left at the original space lay under the moved piece
+		auto pieceLeft = gameMap.GetPieceAt(move.from);
+		heightBefore = pieceLeft == NO_PIECE ? 0 : GetHeight(gameMap, pieceLeft) + 1;
+	}
+
+	for (int perspective = 0; perspective < 2; perspective++) {
+		auto anchor = GetAnchor(gameMap, perspective);
+		if (anchor != previous.anchors[perspective]) {
+			RefreshView(gameMap, perspective, accumulator);
+			continue;
+		}
+
+		accumulator.anchors[perspective] = anchor;
+		const std::int16_t* removed = nullptr;
+		if (!move.isPlacement) {
+			removed = GetFeatureWeights(GetFeatureIndex(perspective, anchor, move.piece, move.from, heightBefore));
+		}
+		const auto* added = GetFeatureWeights(GetFeatureIndex(perspective, anchor, move.piece, move.to, heightAfter));
+		ApplyFeatures(previous.values[perspective].data(), removed, added, accumulator.values[perspective].data());
+	}
+}
+
+int NnueNetwork::Evaluate(const nnueAccumulator& accumulator, int IDOfPlayer) const {
+	// Each view fits into 32 bits, but both of them with the bias may not
+	std::int64_t output = outputBias;
+	output += DotClippedView(accumulator.values[IDOfPlayer].data(), outputWeights.data());
+	output += DotClippedView(accumulator.values[(IDOfPlayer + 1) % 2].data(), outputWeights.data() + HIDDEN_SIZE);
+	return (int)(output / OUTPUT_SCALE);
+}
@@ -0,0 +1,227 @@
+/**
+ * @file Nnue.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the small quantized neural network evaluating positions with incrementally updated first layer
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef NNUE_H
+#define NNUE_H
+
+#include "HiveBoard.h"
+#include "bugTiles.h"
+#include "common.h"
+#include "hexUtilities.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief First layer of the network from the view of both players.
+ *
+ * Kept for every ply of the search and updated from the accumulator of the previous ply, so taking back the move costs
+ * nothing.
+ */
+struct nnueAccumulator {
+	static constexpr int HIDDEN_SIZE = 256; /**< Number of neurons of the first layer of one view. */
+
+	alignas(32) std::array<std::array<std::int16_t, HIDDEN_SIZE>, 2> values; /**< Neurons of the view of each player. */
+	std::array<HexCords, 2> anchors;                                         /**< Anchor of the view of each player. */
+};
+
+/**
+ * @brief Efficiently updatable neural network (NNUE) evaluating positions.
+ *
+ * Input features are (piece, cell, stack height) from the view of each player. Pieces are numbered so own pieces come
+ * first and cells are relative to own Queen (or to (0, 0) before it is placed), taken modulo CELLS_SIZE in both
+ * coordinates. Sums of weights of active features form the first layer, that is changed only by features of the moved
+ * piece; whole view is recomputed only when the Queen of its player moves. Clipped ReLU of both views, own view first,
+ * feeds single output neuron.
+ *
+ * All weights are 16-bit integers. Kernels use AVX2 or SSE2 when the compiler targets them, scalar code otherwise. The
+ * scalar kernels are always compiled, so the vectorized ones can be compared with them.
+ */
+class NnueNetwork {
+public:
+	static constexpr int HIDDEN_SIZE = nnueAccumulator::HIDDEN_SIZE; /**< Number of neurons of one view. */
+	static constexpr int CELLS_SIZE = 16;                            /**< Number of distinct values of coordinate. */
+	static constexpr int HEIGHTS_COUNT = 4;                          /**< Number of distinct stack heights. */
+	static constexpr int FEATURES_COUNT = PIECES_COUNT * CELLS_SIZE * CELLS_SIZE * HEIGHTS_COUNT; /**< Inputs. */
+	static constexpr int ACTIVATION_LIMIT = 127; /**< Upper bound of the clipped ReLU. */
+	static constexpr int OUTPUT_SCALE = 64;      /**< Divisor of the output neuron giving the score. */
+	static constexpr std::uint32_t FILE_MAGIC = 0x45554E48; /**< "HNUE" at the start of the weights file. */
+	static constexpr std::uint32_t FILE_VERSION = 1;        /**< Version of the weights file. */
+#if defined(__AVX2__)
+	static constexpr const char* KERNELS_NAME = "AVX2"; /**< Instruction set of ApplyFeatures and DotClippedView. */
+#elif defined(__SSE2__)
+	static constexpr const char* KERNELS_NAME = "SSE2"; /**< Instruction set of ApplyFeatures and DotClippedView. */
+#else
+	static constexpr const char* KERNELS_NAME = "scalar"; /**< Instruction set of ApplyFeatures and DotClippedView. */
+#endif
+
+	/**
+	 * @brief Loads weights from the binary file.
+	 *
+	 * File contains little-endian magic, version, HIDDEN_SIZE and FEATURES_COUNT as 32-bit integers, then 16-bit biases
+	 * of the first layer, 16-bit weights of the first layer ordered by feature, 16-bit weights of the output (own view
+	 * first) and 32-bit bias of the output.
+	 *
+	 * @param path The path to the file.
+	 * @throws std::runtime_error If the file can't be read or doesn't match the network.
+	 */
+	void LoadFromFile(const std::string& path);
+
+	/**
+	 * @brief Checks if weights have been loaded.
+	 *
+	 * @return True if the network can be used, false otherwise.
+	 */
+	bool IsLoaded() const { return !featureWeights.empty(); }
+
+	/**
+	 * @brief Computes both views of the accumulator from scratch.
+	 *
+	 * @param gameMap The game board.
+	 * @param accumulator The computed accumulator.
+	 */
+	void Refresh(const HiveBoard& gameMap, nnueAccumulator& accumulator) const;
+
+	/**
+	 * @brief Computes the accumulator after the move from the accumulator before it.
+	 *
+	 * @param gameMap The game board after the move.
+	 * @param move The played move, pass just copies the accumulator.
+	 * @param previous The accumulator before the move.
+	 * @param accumulator The computed accumulator.
+	 */
+	void Update(const HiveBoard& gameMap, const Move& move, const nnueAccumulator& previous,
+	            nnueAccumulator& accumulator) const;
+
+	/**
+	 * @brief Evaluates the position.
+	 *
+	 * @param accumulator The accumulator of the position.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @return Score of the position from the view of the player on turn.
+	 */
+	int Evaluate(const nnueAccumulator& accumulator, int IDOfPlayer) const;
+
+	/**
+	 * @brief Computes output = input - removed + added over one view, removed or added can be nullptr.
+	 *
+	 * Uses the vectorized kernel of KERNELS_NAME. Sums wrap around like 16-bit integers in all kernels.
+	 *
+	 * @param input Neurons of the view before the change, aligned to 32 bytes.
+	 * @param removed Weights of the removed feature or nullptr.
+	 * @param added Weights of the added feature or nullptr.
+	 * @param output Neurons of the view after the change, aligned to 32 bytes, can be the same as input.
+	 */
+	static void ApplyFeatures(const std::int16_t* input, const std::int16_t* removed, const std::int16_t* added,
+	                          std::int16_t* output);
+
+	/**
+	 * @brief Scalar version of ApplyFeatures.
+	 *
+	 * @param input Neurons of the view before the change.
+	 * @param removed Weights of the removed feature or nullptr.
+	 * @param added Weights of the added feature or nullptr.
+	 * @param output Neurons of the view after the change, can be the same as input.
+	 */
+	static void ApplyFeaturesScalar(const std::int16_t* input, const std::int16_t* removed,
+	                                const std::int16_t* added, std::int16_t* output);
+
+	/**
+	 * @brief Computes dot product of clipped ReLU of one view and the weights.
+	 *
+	 * Uses the vectorized kernel of KERNELS_NAME. The product fits into 32 bits for any weights, as HIDDEN_SIZE
+	 * activations are atmost ACTIVATION_LIMIT.
+	 *
+	 * @param values Neurons of the view, aligned to 32 bytes.
+	 * @param weights Weights of the output belonging to the view, aligned to 32 bytes.
+	 * @return The dot product.
+	 */
+	static std::int32_t DotClippedView(const std::int16_t* values, const std::int16_t* weights);
+
+	/**
+	 * @brief Scalar version of DotClippedView.
+	 *
+	 * @param values Neurons of the view.
+	 * @param weights Weights of the output belonging to the view.
+	 * @return The dot product.
+	 */
+	static std::int32_t DotClippedViewScalar(const std::int16_t* values, const std::int16_t* weights);
+
+private:
+	/**
+	 * @brief Get the anchor of the view of the player.
+	 *
+	 * @param gameMap The game board.
+	 * @param perspective The ID of the player.
+	 * @return Position of the player's Queen or (0, 0) if it isn't on the board.
+	 */
+	static HexCords GetAnchor(const HiveBoard& gameMap, int perspective) {
+		auto queen = MakePieceId(perspective, 0, 0);
+		return gameMap.IsPieceOnBoard(queen) ? gameMap.GetPositionOfPiece(queen) : HexCords(0, 0);
+	}
+
+	/**
+	 * @brief Get the number of pieces under the piece.
+	 *
+	 * @param gameMap The game board.
+	 * @param piece The id of the piece on the board.
+	 * @return int
+	 */
+	static int GetHeight(const HiveBoard& gameMap, pieceId piece) {
+		int height = 0;
+		for (auto under = gameMap.GetPieceUnder(piece); under != NO_PIECE; under = gameMap.GetPieceUnder(under)) {
+			height++;
+		}
+		return height;
+	}
+
+	/**
+	 * @brief Get the index of the feature.
+	 *
+	 * @param perspective The ID of the player of the view.
+	 * @param anchor The anchor of the view.
+	 * @param piece The id of the piece.
+	 * @param cords The coordinates of the piece.
+	 * @param height The number of pieces under the piece.
+	 * @return int
+	 */
+	static int GetFeatureIndex(int perspective, const HexCords& anchor, pieceId piece, const HexCords& cords,
+	                           int height) {
+		int relativePiece = (piece + perspective * PIECES_PER_PLAYER) % PIECES_COUNT;
+		int cell = ((cords.q - anchor.q) & (CELLS_SIZE - 1)) * CELLS_SIZE + ((cords.r - anchor.r) & (CELLS_SIZE - 1));
+		return (relativePiece * CELLS_SIZE * CELLS_SIZE + cell) * HEIGHTS_COUNT + std::min(height, HEIGHTS_COUNT - 1);
+	}
+
+	/**
+	 * @brief Computes the view of the player from scratch.
+	 *
+	 * @param gameMap The game board.
+	 * @param perspective The ID of the player.
+	 * @param accumulator The accumulator, whose view is computed.
+	 */
+	void RefreshView(const HiveBoard& gameMap, int perspective, nnueAccumulator& accumulator) const;
+
+	/**
+	 * @brief Get the weights of the feature.
+	 *
+	 * @param feature The index of the feature.
+	 * @return Pointer to HIDDEN_SIZE weights.
+	 */
+	const std::int16_t* GetFeatureWeights(int feature) const { return featureWeights.data() + feature * HIDDEN_SIZE; }
+
+	std::vector<std::int16_t> featureWeights;                 /**< Weights of the first layer, HIDDEN_SIZE per feature. */
+	alignas(32) std::array<std::int16_t, HIDDEN_SIZE> featureBiases;     /**< Biases of the first layer. */
+	alignas(32) std::array<std::int16_t, 2 * HIDDEN_SIZE> outputWeights; /**< Weights of the output, own view first. */
+	std::int32_t outputBias = 0;                                         /**< Bias of the output. */
+};
+
+#endif  // !NNUE_H
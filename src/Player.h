@@ -26,11 +26,6 @@
 #include <string>
 #include <vector>
 
-/**
- * @brief Type alias for player piece and his amount, that player has
- */
-using playerPiece = std::pair<bugType, int>;
-
 class Player {
 public:
 	/**
@@ -52,7 +47,10 @@ public:
 	 *
 	 * @param name
 	 */
-	void SetName(const std::string& name) { this->name = name; }
+	void SetName(const std::string& name) {
+		this->name = name;
+		version++;
+	}
 
 	/**
 	 * @brief Get the Player Avaible pieces
@@ -67,7 +65,20 @@ public:
 	 * @param index
 	 * @param ammunt
 	 */
-	void ModifieAvaiblePiecesCount(const int& index, const int& amount) { avaiblePlayerpieces[index].second += amount; }
+	void ModifieAvaiblePiecesCount(const int& index, const int& amount) {
+		avaiblePlayerpieces[index].second += amount;
+		version++;
+	}
+
+	/**
+	 * @brief Get the version of the data shown in the player field
+	 *
+	 * Version changes with the name and with count of every piece, so the field has to be rendered again only then.
+	 *
+	 * @return int
+	 */
+	int GetVersion() const { return version; }
+
 	/**
 	 * @brief Check if player has placed queen
 	 *
@@ -76,7 +87,15 @@ public:
 	 */
 	bool HasPlacedQueen() { return avaiblePlayerpieces[0].second == 0; }
 
-	const TileData* const GetTileDataAtIndex(int index) const { return &(bugTileData[index]); }
+	/**
+	 * @brief Get the id of the next piece at index, that player would place.
+	 *
+	 * @param index Index of the piece in the player field.
+	 * @return pieceId
+	 */
+	pieceId GetPieceIdAtIndex(int index) const {
+		return MakePieceId(playerId, index, STARTING_PIECES[index].second - avaiblePlayerpieces[index].second);
+	}
 
 private:
 	const int playerId = std::numeric_limits<int>::max();
@@ -90,26 +109,16 @@ private:
 	 *
 	 * This initializes the vector `avaiblePlayerpieces` with specific numbers of different player pieces.
 	 *
-	 * The initialization includes:
+	 * The initialization includes (see STARTING_PIECES):
 	 * - 1 Queen Bee
 	 * - 2 Spiders
 	 * - 2 Beetles
 	 * - 3 Grasshoppers
 	 * - 3 Soldier Ants
 	 */
-	std::array<playerPiece, DIFFERENT_PIECES_COUNT> avaiblePlayerpieces = { { { bugType::QUEEN_BEE, 1 },
-		                                                                      { bugType::SPIDER, 2 },
-		                                                                      { bugType::BEETLE, 2 },
-		                                                                      { bugType::GRASS_HOPPER, 3 },
-		                                                                      { bugType::SOLDIER_ANT, 3 } } };
-
-	const std::array<TileData, DIFFERENT_PIECES_COUNT> bugTileData = {
-		{ { bugType::QUEEN_BEE, QUEEN_BEE_COLOR, playerId },
-		  { bugType::SPIDER, SPIDER_COLOR, playerId },
-		  { bugType::BEETLE, BEETLE_COLOR, playerId },
-		  { bugType::GRASS_HOPPER, GRASS_HOPPER_COLOR, playerId },
-		  { bugType::SOLDIER_ANT, SOLDIER_ANT_COLOR, playerId } }
-	};
+	std::array<playerPiece, DIFFERENT_PIECES_COUNT> avaiblePlayerpieces = STARTING_PIECES;
+
+	int version = 0; /**< Increased by every change of the name or the available pieces. */
 };
 
 #endif  // !PLAYER_H
\ No newline at end of file
@@ -2,68 +2,244 @@
 #include "raymath.h"
 #include "Renderer.h"
 #include "rlgl.h"
+#include "Trace.h"
 
+#include <algorithm>
+#include <cmath>
 #include <exception>
 #include <iostream>
 
 Renderer::Renderer() {
 	WindowInitialization();
 	VariableInitialization();
+	LoadLayers();
+	hexBatch.Load();
 }
-void Renderer::RenderBaseLayout(const hexTileMap& map, const Player players[2], const int idOfPlayerOnTurn) {
-	ClearBackground(BLACK);
-	RenderHexMap(map);
-	RenderPlayerFields();
-	RenderPlayers(players, idOfPlayerOnTurn);
 
-	// Debug
-	if (DEBUG_MODE) DisplayFrameTime();
+Renderer::~Renderer() {
+	// Textures and buffers are released together with the window, if it has been closed already
+	if (IsWindowReady()) {
+		UnloadLayers();
+		hexBatch.Unload();
+	}
+}
+
+void Renderer::LoadLayers() {
+	TRACE_SCOPE("Renderer::LoadLayers");
+	UnloadLayers();
+
+	boardLayer = LoadRenderTexture((int)windowSize.x, (int)windowSize.y);
+	isBoardLayerValid = false;
+
+	tileAtlas.Load(hexSize, lineThickness);
+	for (int i = 0; i < 2; i++) {
+		playerFieldLayers[i] = LoadRenderTexture((int)std::ceil(sideSize), (int)windowSize.y);
+		playerFieldVersions[i] = -1;
+	}
+}
+
+void Renderer::UnloadLayers() {
+	if (boardLayer.id != 0) {
+		UnloadRenderTexture(boardLayer);
+	}
+	tileAtlas.Unload();
+	for (const auto& layer : playerFieldLayers) {
+		if (layer.id != 0) {
+			UnloadRenderTexture(layer);
+		}
+	}
+	boardLayer = { 0 };
+	playerFieldLayers[0] = playerFieldLayers[1] = { 0 };
+}
+
+void Renderer::UpdateWindowSize() {
+	windowSize.x = (float)GetScreenWidth();
+	windowSize.y = (float)GetScreenHeight();
+	UpdateLayout();
+	LoadLayers();
+}
+
+bool Renderer::CheckWindowResized() {
+	if (!IsWindowResized()) {
+		return false;
+	}
+	UpdateWindowSize();
+	return true;
+}
+
+void Renderer::RenderBaseLayout(const HiveBoard& map, const Player players[2], const int idOfPlayerOnTurn) {
+	TRACE_SCOPE("Renderer::RenderBaseLayout");
+	UpdateBoardLayer(map);
+	// Layer is opaque and covers the whole window, so the screen doesn't have to be cleared. Texture is upside down.
+	DrawTextureRec(boardLayer.texture,
+	               Rectangle(0, 0, (float)boardLayer.texture.width, -(float)boardLayer.texture.height), Vector2(0, 0),
+	               WHITE);
+	// Borders overlap the player field layers
+	RenderPlayers(players, idOfPlayerOnTurn);
+	RenderPlayerFields();
 }
 
 void Renderer::RenderPlayerFields() {
 	// Player1
-	DrawRectangle(0, 0, (int)sideSize, (int)windowSize.y, PLAYER_BACKGROUND_COLOR);
 	DrawLineEx(Vector2(sideSize, 0), Vector2(sideSize, windowSize.y), 4, TEXT_COLOR);
 
 	// Player2
-	DrawRectangle((int)(windowSize.x - sideSize), 0, (int)sideSize, (int)windowSize.y, PLAYER_BACKGROUND_COLOR);
 	DrawLineEx(Vector2(windowSize.x - sideSize, 0), Vector2(windowSize.x - sideSize, windowSize.y), 4, TEXT_COLOR);
 }
 
-void Renderer::RenderHexMap(const hexTileMap& map) {
-	Vector2 hexScreenPos;
+void Renderer::UpdateLayoutCache() {
+	TRACE_SCOPE("Renderer::UpdateLayoutCache");
+	auto topLeft = GetScreenToWorld2D(Vector2(0, 0), camera);
+	auto bottomRight = GetScreenToWorld2D(windowSize, camera);
+	visibleArea = Rectangle(topLeft.x - hexSize, topLeft.y - hexSize, bottomRight.x - topLeft.x + hexSize * 2,
+	                        bottomRight.y - topLeft.y + hexSize * 2);
+	// Zoomed out map shows only pieces, they are few enough to be culled one by one
+	if (GetDetailLevel() != DetailLevel::FULL) {
+		cacheFirstRows.clear();
+		hexScreenPositions.clear();
+		return;
+	}
+
+	topLeft.x -= defaultOffset + horizontalOffset + hexSize;
+	topLeft.y -= defaultOffset + verticalOffset + hexSize;
+	bottomRight.x -= defaultOffset + horizontalOffset - hexSize;
+	bottomRight.y -= defaultOffset + verticalOffset - hexSize;
+
+	// Inverse of CalculateScreenPos, rows of every column are shifted by half of the column
+	cacheFirstColumn = (int)std::floor(topLeft.x / (hexSize * 3 / 2));
+	int lastColumn = (int)std::ceil(bottomRight.x / (hexSize * 3 / 2));
+	cacheRowsCount = (int)std::ceil((bottomRight.y - topLeft.y) / (hexSize * SQRT_OF_THREE)) + 2;
+
+	cacheFirstRows.resize((size_t)(lastColumn - cacheFirstColumn + 1));
+	hexScreenPositions.resize(cacheFirstRows.size() * cacheRowsCount);
+	for (int column = 0; column < (int)cacheFirstRows.size(); column++) {
+		int q = cacheFirstColumn + column;
+		cacheFirstRows[column] = (int)std::floor(topLeft.y / (hexSize * SQRT_OF_THREE) - q / 2.0f);
+		for (int row = 0; row < cacheRowsCount; row++) {
+			hexScreenPositions[(size_t)column * cacheRowsCount + row] =
+			    CalculateScreenPos(HexCords(q, cacheFirstRows[column] + row));
+		}
+	}
+}
 
-	for (const auto& hex : map) {
-		hexScreenPos = CalculateScreenPos(hex.first);
-		RenderHexOnPosition(hex.second.get(), hexScreenPos);
+void Renderer::RenderHexMap(const HiveBoard& map) {
+	TRACE_SCOPE("Renderer::RenderHexMap");
+	auto detailLevel = GetDetailLevel();
+	if (detailLevel == DetailLevel::FULL) {
+		for (int column = 0; column < (int)cacheFirstRows.size(); column++) {
+			for (int row = 0; row < cacheRowsCount; row++) {
+				HexCords cords(cacheFirstColumn + column, cacheFirstRows[column] + row);
+				AddHexToBatch(map.GetPieceAt(cords), hexScreenPositions[(size_t)column * cacheRowsCount + row]);
+			}
+		}
+		DrawHexBatch();
+		return;
 	}
+
+	// Empty spaces are left out below the full detail, the cleared layer is their background
+	// Point is atleast one pixel on the screen
+	float pointSize = std::max(hexSize, 1 / camera.zoom);
+	map.ForEachOccupiedTile([&](const HexCords& cords, pieceId hex) {
+		auto hexScreenPos = CalculateScreenPos(cords);
+		if (!IsVisible(hexScreenPos)) {
+			return;
+		}
+		const auto& tileData = GetTileData(hex);
+		if (detailLevel == DetailLevel::FLAT) {
+			auto baseColor = tileData.playerId == 0 ? FIRST_PLAYER_COLORS.second : SECOND_PLAYER_COLORS.second;
+			hexBatch.Add(hexScreenPos, BLANK, tileData.bugColor, baseColor);
+		} else {
+			DrawRectangleV(Vector2(hexScreenPos.x - pointSize / 2, hexScreenPos.y - pointSize / 2),
+			               Vector2(pointSize, pointSize), tileData.bugColor);
+		}
+	});
+	DrawHexBatch();
 }
-void Renderer::RenderHexOnPosition(const BaseBugTile* hex, Vector2 hexScreenPos) {
-	if (hex == nullptr) {
-		DrawDefaultHex(hexScreenPos);
+void Renderer::InvalidateHex(const HexCords& cords) { dirtyHexes.push_back(cords); }
+
+void Renderer::UpdateBoardLayer(const HiveBoard& map) {
+	TRACE_SCOPE("Renderer::UpdateBoardLayer");
+	if (isBoardLayerValid && dirtyHexes.empty()) {
+		return;
+	}
+
+	BeginTextureMode(boardLayer);
+	BeginMode2D(camera);
+	if (!isBoardLayerValid || GetDetailLevel() != DetailLevel::FULL) {
+		ClearBackground(BLACK);
+		if (!isBoardLayerValid) {
+			UpdateLayoutCache();
+		}
+		RenderHexMap(map);
+		isBoardLayerValid = true;
 	} else {
-		DrawBugHex(hexScreenPos, hex);
+		// Empty space and piece cover the same polygon, so redrawn hex tile fully overwrites the old one
+		for (const auto& cords : dirtyHexes) {
+			auto hexScreenPos = GetScreenPos(cords);
+			if (IsVisible(hexScreenPos)) {
+				AddHexToBatch(map.GetPieceAt(cords), hexScreenPos);
+			}
+		}
+		DrawHexBatch();
+	}
+	EndMode2D();
+	EndTextureMode();
+	dirtyHexes.clear();
+}
+
+void Renderer::AddHexToBatch(const pieceId hex, Vector2 hexScreenPos) {
+	if (hex == NO_PIECE) {
+		hexBatch.Add(hexScreenPos, WHITE, BLACK);
+		return;
+	}
+
+	const auto& tileData = GetTileData(hex);
+	switch (tileData.playerId) {
+		case 0:
+			hexBatch.Add(hexScreenPos, FIRST_PLAYER_COLORS.first, FIRST_PLAYER_COLORS.second, tileData.bugColor);
+			break;
+		case 1:
+			hexBatch.Add(hexScreenPos, SECOND_PLAYER_COLORS.first, SECOND_PLAYER_COLORS.second, tileData.bugColor);
+			break;
+		default:
+			throw std::runtime_error("AAaaaaa bad playerrrr");
+			break;
 	}
 }
 
+void Renderer::DrawHexBatch() { hexBatch.Draw(hexSize - lineThickness, lineThickness, hexSize / 2); }
+
 void Renderer::HighLightSelectedHex(std::variant<std::pair<int, int>, HexCords> selectedHex) {
+	TRACE_SCOPE("Renderer::HighLightSelectedHex");
 	if (auto cords = std::get_if<HexCords>(&selectedHex)) {
-		auto hexScreenPos = CalculateScreenPos(*cords);
-		DrawPolyLinesEx(hexScreenPos, HEXAGON_SIDES_COUNT, hexSize - lineThickness, 0, lineThickness, HIGHLIGHT_COLOR);
+		auto hexScreenPos = GetScreenPos(*cords);
+		if (!IsVisible(hexScreenPos)) {
+			return;
+		}
+		BeginMode2D(camera);
+		hexBatch.Add(hexScreenPos, HIGHLIGHT_COLOR, BLANK);
+		DrawHexBatch();
+		EndMode2D();
 	} else {
+		// Highlighted tile from the atlas covers the tile in the player field
 		auto playersIndexes = std::get<0>(selectedHex);
 		float x = (windowSize.x - sideSize) * playersIndexes.first + sideSize / 2;
 		float y = offsetOfHexInPlayerField + spacingOfHexInPlayerField * playersIndexes.second;
-		DrawPolyLinesEx(Vector2(x, y), HEXAGON_SIDES_COUNT, hexSize - lineThickness, 0, lineThickness, HIGHLIGHT_COLOR);
+		tileAtlas.Draw(Vector2(x, y), playersIndexes.first, STARTING_PIECES[playersIndexes.second].first, true);
 	}
 }
 
 void Renderer::HighLightPossibleMoves(const possibleMovesSet& possibleMoves) {
+	TRACE_SCOPE("Renderer::HighLightPossibleMoves");
+	BeginMode2D(camera);
 	for (const auto& cord : possibleMoves) {
-		auto hexScreenPos = CalculateScreenPos(cord);
-		DrawPolyLinesEx(hexScreenPos, HEXAGON_SIDES_COUNT, hexSize - lineThickness, 0, lineThickness,
-		                POSSIBLE_MOVES_HIGHLIGHT_COLOR);
+		auto hexScreenPos = GetScreenPos(cord);
+		if (IsVisible(hexScreenPos)) {
+			hexBatch.Add(hexScreenPos, POSSIBLE_MOVES_HIGHLIGHT_COLOR, BLANK);
+		}
 	}
+	DrawHexBatch();
+	EndMode2D();
 }
 
 bool Renderer::IsMouseInPlayersFields() {
@@ -112,33 +288,44 @@ std::pair<std::string, Color> Renderer::GetColorAndNameFromBugType(bugType type)
 }
 
 void Renderer::RenderPlayers(const Player players[2], const int idOfPlayerOnTurn) {
-	float startHeight = 0;
-	float startWidth = 0;
-	std::pair<Color, Color> playerColor;
-	for (size_t i = 0; i < 2; i++) {
-		float startHeight = 10;
-		float startWidth = (windowSize.x - sideSize) * i;
-
-		if (i == idOfPlayerOnTurn) {
-			RenderCenteredText(players[i].GetName().c_str(), Vector2(startWidth, 10), sideSize, PLAYER_ON_TURN_COLOR);
-		} else {
-			RenderCenteredText(players[i].GetName().c_str(), Vector2(startWidth, 10), sideSize);
+	TRACE_SCOPE("Renderer::RenderPlayers");
+	for (int i = 0; i < 2; i++) {
+		// Change of turn recolors names of both players
+		if (players[i].GetVersion() != playerFieldVersions[i] || idOfPlayerOnTurn != playerOnTurnOfFieldLayers) {
+			BeginTextureMode(playerFieldLayers[i]);
+			ClearBackground(PLAYER_BACKGROUND_COLOR);
+			RenderPlayerField(players[i], i, i == idOfPlayerOnTurn);
+			EndTextureMode();
+			playerFieldVersions[i] = players[i].GetVersion();
 		}
+	}
+	playerOnTurnOfFieldLayers = idOfPlayerOnTurn;
 
-		startHeight += FONT_SIZE + 10;
+	for (int i = 0; i < 2; i++) {
+		const auto& layer = playerFieldLayers[i].texture;
+		DrawTextureRec(layer, Rectangle(0, 0, (float)layer.width, -(float)layer.height),
+		               Vector2((windowSize.x - sideSize) * i, 0), WHITE);
+	}
+}
 
-		DrawLineEx(Vector2(startWidth, startHeight), Vector2(startWidth + sideSize, startHeight), 4, TEXT_COLOR);
+void Renderer::RenderPlayerField(const Player& player, const int playerId, const bool isOnTurn) {
+	float startHeight = 10;
 
-		startHeight += 15;
+	if (isOnTurn) {
+		RenderCenteredText(player.GetName().c_str(), Vector2(0, startHeight), sideSize, PLAYER_ON_TURN_COLOR);
+	} else {
+		RenderCenteredText(player.GetName().c_str(), Vector2(0, startHeight), sideSize);
+	}
 
-		auto piecesToRender = players[i].GetPlayerAvaiblepieces();
+	startHeight += FONT_SIZE + 10;
 
-		i == 0 ? playerColor = FIRST_PLAYER_COLORS : playerColor = SECOND_PLAYER_COLORS;
-		for (const auto& piece : piecesToRender) {
-			startHeight += RenderPlayersPiecePanel(piece, Vector2(startWidth, startHeight), sideSize, TEXT_COLOR,
-			                                       FONT_SIZE, playerColor.first, playerColor.second);
-			startHeight += 15;
-		}
+	DrawLineEx(Vector2(0, startHeight), Vector2(sideSize, startHeight), 4, TEXT_COLOR);
+
+	startHeight += 15;
+
+	for (const auto& piece : player.GetPlayerAvaiblepieces()) {
+		startHeight += RenderPlayersPiecePanel(piece, playerId, Vector2(0, startHeight), sideSize);
+		startHeight += 15;
 	}
 }
 
@@ -148,24 +335,23 @@ void Renderer::RenderCenteredText(const char* text, const Vector2& startPosition
 	DrawText(text, (int)(startPosition.x + (avaibleSpace - textWidth) / 2), (int)startPosition.y, fontSize, textColor);
 }
 
-void Renderer::DrawCenteredBugHex(const Vector2& startPosition, const float avaibleSpace, Color outlineColor,
-                                  Color hexBaseColor, Color hexSecondaryColor) {
+void Renderer::DrawCenteredBugHex(const Vector2& startPosition, const float avaibleSpace, const int playerId,
+                                  bugType type) {
 	float xPosition = startPosition.x + avaibleSpace / 2;
 	float yPosition = startPosition.y + SQRT_OF_THREE * hexSize / 2;
 
-	DrawBugHex(Vector2(xPosition, yPosition), outlineColor, hexBaseColor, hexSecondaryColor);
+	tileAtlas.Draw(Vector2(xPosition, yPosition), playerId, type);
 }
 
-float Renderer::RenderPlayersPiecePanel(const playerPiece& piece, const Vector2& startPosition,
-                                        const float avaibleSpace, Color textColor, int fontSize, Color outlineColor,
-                                        Color hexBaseColor) {
+float Renderer::RenderPlayersPiecePanel(const playerPiece& piece, const int playerId, const Vector2& startPosition,
+                                        const float avaibleSpace, Color textColor, int fontSize) {
 	auto playersPieceToRender = GetColorAndNameFromBugType(piece.first);
 
 	RenderCenteredText(playersPieceToRender.first.c_str(), startPosition, avaibleSpace, textColor, fontSize);
 	RenderCenteredText(TextFormat("%i left", piece.second), Vector2(startPosition.x, startPosition.y + fontSize + 5),
 	                   avaibleSpace, textColor, fontSize);
-	DrawCenteredBugHex(Vector2(startPosition.x, startPosition.y + fontSize * 2 + 10), avaibleSpace, outlineColor,
-	                   hexBaseColor, playersPieceToRender.second);
+	DrawCenteredBugHex(Vector2(startPosition.x, startPosition.y + fontSize * 2 + 10), avaibleSpace, playerId,
+	                   piece.first);
 
 	// How big is the panel
 	return fontSize * 2 + 15 + SQRT_OF_THREE * hexSize;
@@ -175,10 +361,12 @@ void Renderer::WindowInitialization() {
 	// Initialization
 	//--------------------------------------------------------------------------------------
 	// Display fps
-	if (!DEBUG_MODE) SetTargetFPS(FPS);
+	SetTargetFPS(FPS);
 
 	// Screen Size
+	SetConfigFlags(FLAG_WINDOW_RESIZABLE);
 	InitWindow(1280, 720, "Project Hive");
+	SetWindowMinSize(MIN_WINDOW_WIDTH, MIN_WINDOW_HEIGHT);
 
 	displayIdentifier = GetCurrentMonitor();
 	windowSize.x = (GetMonitorWidth(displayIdentifier) * WINDOW_SCALING);
@@ -190,7 +378,6 @@ void Renderer::WindowInitialization() {
 	SetWindowPosition((int)windowPosition.x, (int)windowPosition.y);
 	SetWindowSize((int)windowSize.x, (int)windowSize.y);
 
-	Camera2D camera = { 0 };
 	camera.zoom = 1.0f;
 }
 
@@ -203,37 +390,27 @@ void Renderer::VariableInitialization() {
 	sideSize = windowSize.x * SIDE_SIZE_PERCENT;
 
 	hexagonHorizontalCount = (int)((windowSize.x - defaultOffset - sideSize * 2) / (hexSize * (3.0 / 2) + 1));
-	sideSize = (float)((windowSize.x - TOLERANCE * 2 - hexagonHorizontalCount * (3.0 / 2) * hexSize - hexSize / 2) / 2);
+	UpdateLayout();
+}
 
+void Renderer::UpdateLayout() {
+	TRACE_SCOPE("Renderer::UpdateLayout");
+	// Columns of width 3/2 of the size, plus half of the size for the last one
+	float hexSizeByHeight = (windowSize.y - TOLERANCE) / (HEXAGON_VERTICAL_COUNT * SQRT_OF_THREE + 1);
+	float hexSizeByWidth = (float)((windowSize.x * (1 - SIDE_SIZE_PERCENT * 2) - TOLERANCE * 2) /
+	                               (hexagonHorizontalCount * (3.0 / 2) + 1.0 / 2));
+	hexSize = std::min(hexSizeByHeight, hexSizeByWidth);
+	lineThickness = hexSize * (float)1.0 / 10;
+	defaultOffset = hexSize;
+
+	sideSize = (float)((windowSize.x - TOLERANCE * 2 - hexagonHorizontalCount * (3.0 / 2) * hexSize - hexSize / 2) / 2);
 	horizontalOffset = sideSize + TOLERANCE;
+	// Map narrower than the window is centered vertically
+	verticalOffset = (windowSize.y - TOLERANCE - hexSize * (HEXAGON_VERTICAL_COUNT * SQRT_OF_THREE + 1)) / 2;
 
 	offsetOfHexInPlayerField = FONT_SIZE * 3 + 45 + SQRT_OF_THREE * hexSize / 2;
 	spacingOfHexInPlayerField = FONT_SIZE * 2 + 30 + SQRT_OF_THREE * hexSize;
-}
-
-void Renderer::DrawDefaultHex(const Vector2& hexScreenPos, Color outlineColor, Color hexBaseColor) {
-	DrawPoly(hexScreenPos, HEXAGON_SIDES_COUNT, hexSize - lineThickness, 0, hexBaseColor);
-	DrawPolyLinesEx(hexScreenPos, HEXAGON_SIDES_COUNT, hexSize - lineThickness, 0, lineThickness, outlineColor);
-}
-void Renderer::DrawBugHex(const Vector2& hexScreenPos, const BaseBugTile* tile) {
-	Color bugColor = tile->GetBugColor();
-	switch (tile->GetPlayerID()) {
-		case 0:
-			DrawBugHex(hexScreenPos, FIRST_PLAYER_COLORS.first, FIRST_PLAYER_COLORS.second, bugColor);
-			break;
-		case 1:
-			DrawBugHex(hexScreenPos, SECOND_PLAYER_COLORS.first, SECOND_PLAYER_COLORS.second, bugColor);
-			break;
-		default:
-			throw std::runtime_error("AAaaaaa bad playerrrr");
-			break;
-	}
-}
 
-void Renderer::DrawBugHex(const Vector2& hexScreenPos, Color outlineColor, Color hexBaseColor,
-                          Color hexSecondaryColor) {
-	DrawDefaultHex(hexScreenPos, outlineColor, hexBaseColor);
-	DrawPoly(hexScreenPos, HEXAGON_SIDES_COUNT, hexSize / 2, 0, hexSecondaryColor);
 }
 
 Vector2 Renderer::CalculateScreenPos(const HexCords& hexPos) {
@@ -242,9 +419,38 @@ Vector2 Renderer::CalculateScreenPos(const HexCords& hexPos) {
 	    hexSize * (SQRT_OF_THREE / 2 * hexPos.q + SQRT_OF_THREE * hexPos.r) + defaultOffset + verticalOffset);
 }
 
+bool Renderer::MoveCamera() {
+	auto previousCamera = camera;
+
+	if (IsKeyPressed(KEY_HOME)) {
+		camera = { 0 };
+		camera.zoom = 1.0f;
+	}
+
+	if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT)) {
+		camera.target = Vector2Subtract(camera.target, Vector2Scale(GetMouseDelta(), 1 / camera.zoom));
+	}
+
+	float wheel = GetMouseWheelMove();
+	if (wheel != 0 && !IsMouseInPlayersFields()) {
+		// Point under the cursor stays in place
+		camera.target = GetScreenToWorld2D(GetMousePosition(), camera);
+		camera.offset = GetMousePosition();
+		camera.zoom = Clamp(camera.zoom * (1 + ZOOM_STEP * wheel), MIN_ZOOM, MAX_ZOOM);
+	}
+
+	if (camera.target.x != previousCamera.target.x || camera.target.y != previousCamera.target.y ||
+	    camera.offset.x != previousCamera.offset.x || camera.offset.y != previousCamera.offset.y ||
+	    camera.zoom != previousCamera.zoom) {
+		isBoardLayerValid = false;
+		return true;
+	}
+	return false;
+}
+
 HexCords Renderer::FindCordsOfHexUnderCursor() const {
 	float q, r;
-	Vector2 mousePosition = GetMousePosition();
+	Vector2 mousePosition = GetScreenToWorld2D(GetMousePosition(), camera);
 
 	mousePosition.x -= defaultOffset + horizontalOffset;
 	mousePosition.y -= defaultOffset + verticalOffset;
@@ -259,9 +465,6 @@ HexCords Renderer::FindCordsOfHexUnderCursor() const {
 
 int Renderer::GetHexagonHorizontalCount() { return hexagonHorizontalCount; }
 
-void Renderer::DisplayFrameTime() {
-	DrawText(TextFormat("%02.02f ms", GetFrameTime() * 1000), 10, (int)(windowSize.y - FONT_SIZE), FONT_SIZE, RED);
-}
 
 void Renderer::DisplayCenteredTextBaner(const std::string& message, const int font_size) {
 	auto bannerSizeX = MeasureText(message.c_str(), font_size) + TOLERANCE * 2 + lineThickness * 2;
@@ -13,21 +13,38 @@
 
 #include "bugTiles.h"
 #include "common.h"
+#include "HexBatch.h"
 #include "hexUtilities.h"
+#include "HiveBoard.h"
 #include "Player.h"
 #include "raylib.h"
 #include "raymath.h"
 #include "rlgl.h"
+#include "TileAtlas.h"
 
 #include <iostream>
 #include <map>
 #include <variant>
+#include <vector>
 
 /**
  * @brief Manages rendering of the game elements.
  *
  * The Renderer class handles rendering of various game elements such as the game map, players, hex tiles,
  * messages, and other UI components.
+ *
+ * The game map is rendered once into the board layer, that is a texture of the window size, and only spaces marked by
+ * InvalidateHex are redrawn into it. Every frame then just draws the layer and the overlays on top of it. Hex tiles of
+ * the map and highlights are collected into HexBatch, so each group of them costs one draw call. Tiles in the player
+ * fields are drawn as single quads from TileAtlas. Each player field is rendered into its own layer too, again only
+ * when the version of the player or the player on turn changes.
+ *
+ * The game map is the unbounded hiveBoard viewed through a camera, that can be panned and zoomed. Visible area and
+ * screen positions of the spaces under the window are computed into the layout cache whenever the board layer is
+ * rendered whole, that is after the camera moves or the window is resized. Positions in the cache are before the
+ * camera transformation, other spaces get their position calculated. Hex tiles, highlights and redrawn spaces outside
+ * of the visible area are skipped, so the cost of a frame depends on the visible part of the map only. Zoomed out map
+ * is rendered with lower level of detail, see DetailLevel.
  */
 class Renderer {
 public:
@@ -38,20 +55,57 @@ public:
 	 */
 	Renderer();
 
+	Renderer(const Renderer&) = delete;
+	Renderer& operator=(const Renderer&) = delete;
+
+	/**
+	 * @brief Destroys the Renderer object, unloading the layers, the hex batch and the tile atlas if the window is
+	 * still open.
+	 */
+	~Renderer();
+
 	/**
 	 * @brief Renders the base layout of the game.
 	 *
 	 * Renders the base layout of the game, including the game map, players, and other elements.
 	 *
-	 * @param map The game map represented as a hexTileMap.
+	 * @param map The game map.
 	 * @param players An array containing the players in the game.
 	 * @param idOfPlayerOnTurn The ID of the player currently on turn.
 	 */
-	void RenderBaseLayout(const hexTileMap& map, const Player players[2], const int idOfPlayerOnTurn);
+	void RenderBaseLayout(const HiveBoard& map, const Player players[2], const int idOfPlayerOnTurn);
+
+	/**
+	 * @brief Marks the hex tile to be redrawn in the board layer.
+	 *
+	 * Must be called for every space of the game map whose piece changes.
+	 *
+	 * @param cords The coordinates of the hex tile.
+	 */
+	void InvalidateHex(const HexCords& cords);
+
+	/**
+	 * @brief Pans and zooms the camera by the mouse.
+	 *
+	 * Dragging with the right mouse button pans the map, mouse wheel zooms around the cursor and Home key resets the
+	 * view.
+	 *
+	 * @return True if the camera has moved, false otherwise.
+	 */
+	bool MoveCamera();
+
+	/**
+	 * @brief Updates the layout and all layers if the window was resized since the last check.
+	 *
+	 * @return True if the window was resized, false otherwise.
+	 */
+	bool CheckWindowResized();
 
 	/**
 	 * @brief Finds the coordinates of the hex tile under the cursor.
 	 *
+	 * The cursor is transformed by the camera, so the result is the hex tile seen under it.
+	 *
 	 * @return The coordinates of the hex tile under the cursor.
 	 */
 	HexCords FindCordsOfHexUnderCursor() const;
@@ -83,7 +137,8 @@ public:
 	/**
 	 * @brief Renders the players on the game screen.
 	 *
-	 * Renders the players on the game screen, including their names, pieces etc.
+	 * Renders the players on the game screen, including their names, pieces etc. Player field is rendered into its
+	 * layer only if it has changed, otherwise just the layer is drawn.
 	 *
 	 * @param players An array containing the players in the game.
 	 * @param idOfPlayerOnTurn The ID of the player currently on turn.
@@ -125,14 +180,39 @@ public:
 
 private:
 	/**
-	 * @brief Renders a hex tile at a specified position.
+	 * @brief Level of detail of the rendered game map, chosen by the size of hexagons on the screen.
+	 */
+	enum class DetailLevel {
+		FULL,  /**< Hex tiles with outlines and the smaller hexagons, empty spaces included. */
+		FLAT,  /**< Pieces as hexagons of their bug color with the base color in the middle, without outlines. */
+		POINTS /**< Pieces as single points of their bug color. */
+	};
+
+	/**
+	 * @brief Get the level of detail for the current zoom of the camera.
 	 *
-	 * Renders a hex tile at the specified screen position.
+	 * @return DetailLevel
+	 */
+	DetailLevel GetDetailLevel() const {
+		float hexSizeOnScreen = hexSize * camera.zoom;
+		if (hexSizeOnScreen >= FLAT_DETAIL_HEX_SIZE) {
+			return DetailLevel::FULL;
+		}
+		return hexSizeOnScreen >= POINTS_DETAIL_HEX_SIZE ? DetailLevel::FLAT : DetailLevel::POINTS;
+	}
+
+	/**
+	 * @brief Adds a hex tile at a specified position to the hex batch.
 	 *
-	 * @param hex A pointer to the hex tile to render.
+	 * @param hex The id of the piece to render or NO_PIECE for empty space.
 	 * @param hexScreenPos The screen position at which to render the hex tile.
 	 */
-	void RenderHexOnPosition(const BaseBugTile* hex, Vector2 hexScreenPos);
+	void AddHexToBatch(const pieceId hex, Vector2 hexScreenPos);
+
+	/**
+	 * @brief Draws all hex tiles added to the hex batch with the size of hex tiles of the map.
+	 */
+	void DrawHexBatch();
 
 	/**
 	 * @brief Renders centered text on the game screen.
@@ -164,27 +244,43 @@ private:
 	                       const Color textColor = TEXT_COLOR, const Color bannerColor = WHITE,
 	                       const Color borderColor = RED);
 	/**
-	 * @brief Displays the frame time on the game screen.
+	 * @brief Renders the player fields on the game screen.
 	 *
-	 * Displays the frame time (frames per second) on the game screen in left bottom corner for debugging purposes.
+	 * Renders the borders of the player fields, their background is part of the player field layers.
 	 */
-	void DisplayFrameTime();
+	void RenderPlayerFields();
 
 	/**
-	 * @brief Renders the player fields on the game screen.
+	 * @brief Renders the content of the player field into the current render target.
+	 *
+	 * Renders the name and the panels of pieces of the player, with the field starting at (0, 0).
 	 *
-	 * Renders the player fields base and base layout.
+	 * @param player The player.
+	 * @param playerId The ID of the player.
+	 * @param isOnTurn True if the player is on turn, false otherwise.
 	 */
-	void RenderPlayerFields();
+	void RenderPlayerField(const Player& player, const int playerId, const bool isOnTurn);
 
 	/**
 	 * @brief Renders the hex map on the game screen.
 	 *
-	 * Renders the hex map. Color of pieces is determined by their type base is black and white.
+	 * Renders the hex map. Color of pieces is determined by their type base is black and white. At the full level of
+	 * detail spaces of the layout cache are visited, their number is bounded by the window, as hexagons are big. Below
+	 * the full level of detail only visible pieces are rendered, without visiting empty spaces.
+	 *
+	 * @param map The game map.
+	 */
+	void RenderHexMap(const HiveBoard& map);
+
+	/**
+	 * @brief Brings the board layer up to date with the game map.
+	 *
+	 * Renders the whole hex map into the layer the first time, afterwards only the invalidated hex tiles. Below the
+	 * full level of detail the layer is always rendered whole, as it holds just the pieces.
 	 *
-	 * @param map The game map represented as a hexTileMap.
+	 * @param map The game map.
 	 */
-	void RenderHexMap(const hexTileMap& map);
+	void UpdateBoardLayer(const HiveBoard& map);
 
 	/**
 	 * @brief Renders a panel displaying information about a player's piece.
@@ -193,17 +289,15 @@ private:
 	 * Information like name, remaining amount and draw picture of the hex tile.
 	 *
 	 * @param piece The player's piece to display information about.
+	 * @param playerId The ID of the player owning the piece.
 	 * @param startPosition The position to start rendering the panel.
 	 * @param availableSpace The available space for rendering the panel.
 	 * @param textColor The color of the text (optional, defaults to TEXT_COLOR).
 	 * @param fontSize The font size of the text (optional, defaults to FONT_SIZE).
-	 * @param outlineColor The color of the panel outline (optional, defaults to WHITE).
-	 * @param hexBaseColor The base color of the hex tile (optional, defaults to BLACK).
 	 * @return The vertical size of the panel;
 	 */
-	float RenderPlayersPiecePanel(const playerPiece& piece, const Vector2& startPosition, const float avaibleSpace,
-	                              Color textColor = TEXT_COLOR, int fontSize = FONT_SIZE, Color outlineColor = WHITE,
-	                              Color hexBaseColor = BLACK);
+	float RenderPlayersPiecePanel(const playerPiece& piece, const int playerId, const Vector2& startPosition,
+	                              const float avaibleSpace, Color textColor = TEXT_COLOR, int fontSize = FONT_SIZE);
 
 	/**
 	 * @brief Initializes the game window.
@@ -220,61 +314,87 @@ private:
 	void VariableInitialization();
 
 	/**
-	 * @brief Draws a centered bug hex tile on the game screen.
+	 * @brief Calculates sizes and positions depending on the window size.
 	 *
-	 * Draws a centered bug hex tile with the specified properties on the game screen.
-	 *
-	 * @param startPosition The position to start rendering the hex tile.
-	 * @param availableSpace The available space for rendering the hex tile.
-	 * @param outlineColor The color of the hex tile outline (optional, defaults to WHITE).
-	 * @param hexBaseColor The base color of the hex tile (optional, defaults to BLACK).
-	 * @param hexSecondaryColor The secondary color of the hex tile (optional, defaults to BLACK).
+	 * Hexagons get as big as the window allows with the fixed number of columns and rows of the default view, the rest
+	 * of the width goes to the player fields.
 	 */
-	void DrawCenteredBugHex(const Vector2& startPosition, const float avaibleSpace, Color outlineColor = WHITE,
-	                        Color hexBaseColor = BLACK, Color hexSecondaryColor = BLACK);
+	void UpdateLayout();
 
 	/**
-	 * @brief Draws a default hex tile at the specified position.
-	 *
-	 * Default hex tile is hex without smaller hex in middle.
+	 * @brief Updates the visible area and fills the layout cache with the spaces under the window for the current
+	 * camera.
 	 *
-	 * @param hexScreenPos The screen position to draw the hex tile.
-	 * @param outlineColor The color of the hex tile outline (optional, defaults to WHITE).
-	 * @param hexBaseColor The base color of the hex tile (optional, defaults to BLACK).
+	 * Both are widened by a hexagon on every side, so partly visible hex tiles are included. The cache is left empty
+	 * below the full level of detail, where empty spaces aren't rendered.
 	 */
-	void DrawDefaultHex(const Vector2& hexScreenPos, Color outlineColor = WHITE, Color hexBaseColor = BLACK);
+	void UpdateLayoutCache();
 
 	/**
-	 * @brief Draws a bug hex tile at the specified position.
+	 * @brief Checks if the hex tile is in the visible area.
 	 *
-	 * Draws a bug hex tile with the properties of the specified tile at the specified position on the game screen.
+	 * @param hexScreenPos The screen position of the hex tile before the camera transformation.
+	 * @return True if the hex tile can be seen in the window, false otherwise.
+	 */
+	bool IsVisible(Vector2 hexScreenPos) const { return CheckCollisionPointRec(hexScreenPos, visibleArea); }
+
+	/**
+	 * @brief Updates the layout and all layers after the window was resized.
+	 */
+	void UpdateWindowSize();
+
+	/**
+	 * @brief Loads the board layer, the player field layers and the tile atlas for the current layout.
 	 *
-	 * @param hexScreenPos The screen position to draw the hex tile.
-	 * @param tile A pointer to the hex tile to draw.
+	 * Previously loaded layers are released, and all layers are rendered again before they are drawn.
 	 */
-	void DrawBugHex(const Vector2& hexScreenPos, const BaseBugTile* tile);
+	void LoadLayers();
 
 	/**
-	 * @brief Draws a bug hex tile at the specified position with custom colors.
+	 * @brief Releases the board layer, the player field layers and the tile atlas.
+	 */
+	void UnloadLayers();
+
+	/**
+	 * @brief Draws a centered bug hex tile on the game screen.
 	 *
-	 * Draws a bug hex tile with custom colors at the specified position on the game screen.
+	 * Draws a centered bug hex tile of the player from the tile atlas.
 	 *
-	 * @param hexScreenPos The screen position to draw the hex tile.
-	 * @param outlineColor The color of the hex tile outline (optional, defaults to WHITE).
-	 * @param hexBaseColor The base color of the hex tile (optional, defaults to BLACK).
-	 * @param hexSecondaryColor The secondary color of the hex tile (optional, defaults to BLACK).
+	 * @param startPosition The position to start rendering the hex tile.
+	 * @param availableSpace The available space for rendering the hex tile.
+	 * @param playerId The ID of the player owning the tile.
+	 * @param type The bug type of the tile.
 	 */
-	void DrawBugHex(const Vector2& hexScreenPos, Color outlineColor = WHITE, Color hexBaseColor = BLACK,
-	                Color hexSecondaryColor = BLACK);
+	void DrawCenteredBugHex(const Vector2& startPosition, const float avaibleSpace, const int playerId, bugType type);
 
 	/**
 	 * @brief Calculates the screen position of a hex tile based on its coordinates.
 	 *
+	 * Used to fill the layout cache, rendering reads positions by GetScreenPos. Position is before the camera
+	 * transformation.
+	 *
 	 * @param hexPos The coordinates of the hex tile.
 	 * @return The screen position of the hex tile.
 	 */
 	Vector2 CalculateScreenPos(const HexCords& hexPos);
 
+	/**
+	 * @brief Get the screen position of a hex tile from the layout cache.
+	 *
+	 * @param hexPos The coordinates of the hex tile.
+	 * @return The screen position of the hex tile, calculated if the hex tile is not in the cache.
+	 */
+	Vector2 GetScreenPos(const HexCords& hexPos) {
+		int column = hexPos.q - cacheFirstColumn;
+		if (column >= 0 && column < (int)cacheFirstRows.size()) {
+			int row = hexPos.r - cacheFirstRows[column];
+			if (row >= 0 && row < cacheRowsCount) {
+				return hexScreenPositions[(size_t)column * cacheRowsCount + row];
+			}
+		}
+		return CalculateScreenPos(hexPos);
+	}
+
 	/**
 	 * @brief Retrieves the color and name associated with a bug type.
 	 *
@@ -292,6 +412,20 @@ private:
 	float sideSize = 0;                                      /**< Size of hexagon sides. */
 	float offsetOfHexInPlayerField = 0;                      /**< Offset of hexagons in the player's field. */
 	float spacingOfHexInPlayerField = 0;                     /**< Spacing of hexagons in the player's field. */
+	RenderTexture2D boardLayer = { 0 };                      /**< The rendered game map. */
+	bool isBoardLayerValid = false;                          /**< Flag indicating whether the layer is rendered. */
+	std::vector<HexCords> dirtyHexes;                        /**< Hex tiles to be redrawn in the board layer. */
+	HexBatch hexBatch;                                       /**< Batch of hex tiles drawn by one draw call. */
+	TileAtlas tileAtlas;                                     /**< Pre-rendered tiles of the player fields. */
+	RenderTexture2D playerFieldLayers[2] = {};               /**< The rendered player fields. */
+	int playerFieldVersions[2] = { -1, -1 };                 /**< Versions of the players in their layers. */
+	int playerOnTurnOfFieldLayers = -1;                      /**< The ID of the player on turn in the layers. */
+	Rectangle visibleArea = { 0 };                           /**< Part of the map under the window widened by a hex. */
+	int cacheFirstColumn = 0;                                /**< The first column of the layout cache. */
+	int cacheRowsCount = 0;                                  /**< The number of rows of every column in the cache. */
+	std::vector<int> cacheFirstRows;                         /**< The first row of every column in the cache. */
+	std::vector<Vector2> hexScreenPositions; /**< Layout cache, screen positions of the spaces under the window. */
+	Camera2D camera = { 0 };                 /**< The camera viewing the game map. */
 };
 
 #endif
\ No newline at end of file
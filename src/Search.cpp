@@ -0,0 +1,149 @@
+#include "Search.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+Search::Search(int transpositionTableSizeBits, const NnueNetwork* network, const Tablebase* tablebase)
+    : transpositionTable((size_t)1 << transpositionTableSizeBits), network(network), tablebase(tablebase) {
+	if (network != nullptr) {
+		accumulators.resize(MAX_PLY + 1);
+	}
+}
+
+void Search::Clear() {
+	std::fill(transpositionTable.begin(), transpositionTable.end(), transpositionEntry());
+	history.Clear();
+}
+
+Move Search::FindBestMove(const HiveBoard& gameMap, int IDOfPlayer, int maxDepth) {
+	HiveBoard board = gameMap;
+	nodesCount = 0;
+	killers.fill(killerMoves());
+	history.Age();
+	if (network != nullptr) {
+		network->Refresh(board, accumulators[0]);
+	}
+	Move bestMove;
+
+	for (int depth = 1; depth <= std::min(maxDepth, MAX_PLY - 1); depth++) {
+		rootBestMove = Move();
+		lastScore = AlphaBeta(board, IDOfPlayer, depth, -INFINITE_SCORE, INFINITE_SCORE, 0);
+		bestMove = rootBestMove;
+
+		// Forced result is already known, deeper search would find the same
+		if (std::abs(lastScore) >= WIN_SCORE - MAX_PLY) {
+			break;
+		}
+	}
+	return bestMove;
+}
+
+int Search::AlphaBeta(HiveBoard& gameMap, int IDOfPlayer, int depth, int alpha, int beta, int ply) {
+	nodesCount++;
+	int opponentId = (IDOfPlayer + 1) % 2;
+
+	bool isLost = gameMap.IsQueenSurrounded(IDOfPlayer);
+	bool isWon = gameMap.IsQueenSurrounded(opponentId);
+	if (isLost || isWon) {
+		return isLost && isWon ? 0 : (isWon ? WIN_SCORE - ply : -WIN_SCORE + ply);
+	}
+
+	Tablebase::Result result;
+	if (ply > 0 && tablebase != nullptr && tablebase->Probe(gameMap, IDOfPlayer, result)) {
+		if (result == Tablebase::Result::DRAW) {
+			return 0;
+		}
+		return result == Tablebase::Result::WIN ? TABLEBASE_WIN_SCORE : -TABLEBASE_WIN_SCORE;
+	}
+	if (depth <= 0 || ply >= MAX_PLY) {
+		int score =
+		    network != nullptr ? network->Evaluate(accumulators[ply], IDOfPlayer) : Evaluate(gameMap, IDOfPlayer);
+		// Output of the network isn't bounded, bigger score would look like a forced result and overflow the table
+		return std::clamp(score, -MAX_EVALUATION_SCORE, MAX_EVALUATION_SCORE);
+	}
+
+	auto key = GetPositionKey(gameMap, IDOfPlayer);
+	auto& entry = transpositionTable[key & (transpositionTable.size() - 1)];
+	Move hashMove;
+	if (entry.key == key && entry.depth >= 0) {
+		hashMove = entry.move;
+		if (ply > 0 && entry.depth >= depth) {
+			int score = ScoreFromTable(entry.score, ply);
+			if (entry.bound == Bound::EXACT || (entry.bound == Bound::LOWER && score >= beta) ||
+			    (entry.bound == Bound::UPPER && score <= alpha)) {
+				return score;
+			}
+		}
+	}
+
+	int originalAlpha = alpha;
+	int bestScore = -INFINITE_SCORE;
+	Move bestMove;
+	bool hasMove = false;
+
+	MovePicker picker(gameMap, IDOfPlayer, hashMove, killers[ply], history, pickerBuffers[ply]);
+	Move move;
+	while (picker.Next(move)) {
+		hasMove = true;
+		gameMap.MakeMove(move);
+		UpdateAccumulator(gameMap, move, ply);
+		int score = -AlphaBeta(gameMap, opponentId, depth - 1, -beta, -alpha, ply + 1);
+		gameMap.UndoMove(move);
+
+		if (score > bestScore) {
+			bestScore = score;
+			bestMove = move;
+			if (score > alpha) {
+				alpha = score;
+				if (alpha >= beta) {
+					if (move != hashMove && move != killers[ply][0]) {
+						killers[ply][1] = killers[ply][0];
+						killers[ply][0] = move;
+					}
+					history.Add(move, std::min(depth * depth, MoveHistory::MAX_SCORE));
+					break;
+				}
+			}
+		}
+	}
+
+	if (!hasMove) {
+		// Player without any legal move passes, game where nobody can move is a draw
+		if (!HasAnyLegalMove(gameMap, opponentId)) {
+			return 0;
+		}
+		UpdateAccumulator(gameMap, Move(), ply);
+		bestScore = -AlphaBeta(gameMap, opponentId, depth - 1, -beta, -alpha, ply + 1);
+	}
+
+	if (ply == 0) {
+		rootBestMove = bestMove;
+	}
+
+	entry.key = key;
+	entry.move = bestMove;
+	entry.score = (std::int16_t)ScoreToTable(bestScore, ply);
+	entry.depth = (std::int8_t)depth;
+	entry.bound = bestScore >= beta ? Bound::LOWER : (bestScore > originalAlpha ? Bound::EXACT : Bound::UPPER);
+	return bestScore;
+}
+
+int Search::ScoreToTable(int score, int ply) {
+	if (score >= WIN_SCORE - MAX_PLY) {
+		return score + ply;
+	}
+	if (score <= -WIN_SCORE + MAX_PLY) {
+		return score - ply;
+	}
+	return score;
+}
+
+int Search::ScoreFromTable(int score, int ply) {
+	if (score >= WIN_SCORE - MAX_PLY) {
+		return score - ply;
+	}
+	if (score <= -WIN_SCORE + MAX_PLY) {
+		return score + ply;
+	}
+	return score;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file Search.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the alpha-beta search of the best move
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include "Evaluation.h"
+#include "HiveBoard.h"
+#include "MovePicker.h"
+#include "Nnue.h"
+#include "Tablebase.h"
+#include "common.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Searches for the best move with iterative deepening alpha-beta (negamax) and transposition table.
+ *
+ * Moves are pulled one at a time from MovePicker, so moves after a cutoff are never generated. Moves which caused cutoff
+ * are remembered as killer moves of their ply and in the history, both feed the ordering of MovePicker. Player without
+ * any legal move passes, position where nobody can move is a draw.
+ *
+ * Leaves are evaluated by the network if it is given, its accumulators are kept for every ply. Otherwise the
+ * handcrafted Evaluate is used. Positions covered by the tablebase are not searched below the root, their result is
+ * scored just under the surrounds found by the search, so surround within the search depth is still preferred. Tables
+ * cover only study positions with empty hands, see Tablebase.
+ */
+class Search {
+public:
+	static constexpr int INFINITE_SCORE = 32000; /**< Score bigger than any reachable score. */
+	static constexpr int WIN_SCORE = 30000;      /**< Score of surrounding opponent's Queen at the root. */
+	static constexpr int MAX_PLY = 128;          /**< Maximal depth of the search. */
+
+	static constexpr int TABLEBASE_WIN_SCORE = WIN_SCORE - 2 * MAX_PLY; /**< Score of won position of the tablebase. */
+	static constexpr int MAX_EVALUATION_SCORE = TABLEBASE_WIN_SCORE - 1; /**< Bound of the score of evaluated leaves. */
+
+	/**
+	 * @brief Constructs a new Search object.
+	 *
+	 * @param transpositionTableSizeBits Binary logarithm of the number of entries of the transposition table.
+	 * @param network The network evaluating leaves, it must outlive the search (nullptr for handcrafted evaluation).
+	 * @param tablebase The endgame tables, they must outlive the search (nullptr for none).
+	 */
+	explicit Search(int transpositionTableSizeBits = 20, const NnueNetwork* network = nullptr,
+	                const Tablebase* tablebase = Tablebase::GetDefault());
+
+	/**
+	 * @brief Finds the best move of the player.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param maxDepth Depth of the last iteration of iterative deepening.
+	 * @return The best move, or move with piece NO_PIECE if the player has to pass.
+	 */
+	Move FindBestMove(const HiveBoard& gameMap, int IDOfPlayer, int maxDepth);
+
+	/**
+	 * @brief Get the score of the last finished search from the view of the player on turn.
+	 *
+	 * @return int
+	 */
+	int GetLastScore() const { return lastScore; }
+
+	/**
+	 * @brief Get the number of nodes visited by the last search.
+	 *
+	 * @return long long
+	 */
+	long long GetNodesCount() const { return nodesCount; }
+
+	/**
+	 * @brief Clears the transposition table and the history.
+	 */
+	void Clear();
+
+private:
+	/**
+	 * @brief Type of the score stored in the transposition table.
+	 */
+	enum class Bound : std::uint8_t {
+		EXACT, /**< The score is exact. */
+		LOWER, /**< The real score is atleast the score (cutoff happened). */
+		UPPER  /**< The real score is atmost the score (no move improved alpha). */
+	};
+
+	/**
+	 * @brief Entry of the transposition table.
+	 */
+	struct transpositionEntry {
+		std::uint64_t key = 0;      /**< Hash of the position including the player on turn. */
+		Move move;                  /**< The best move found in the position. */
+		std::int16_t score = 0;     /**< The score of the position. */
+		std::int8_t depth = -1;     /**< Remaining depth of the search that stored the entry, -1 for empty entry. */
+		Bound bound = Bound::EXACT; /**< Type of the score. */
+	};
+
+	static constexpr std::uint64_t SIDE_TO_MOVE_KEY = 0x9E3779B97F4A7C15ull; /**< Hash key of the second player. */
+
+	/**
+	 * @brief Searches the position with alpha-beta.
+	 *
+	 * @param gameMap The game board, it is restored before returning.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param depth Remaining depth.
+	 * @param alpha Lower bound of the interesting scores.
+	 * @param beta Upper bound of the interesting scores.
+	 * @param ply Distance from the root.
+	 * @return Score of the position from the view of the player on turn.
+	 */
+	int AlphaBeta(HiveBoard& gameMap, int IDOfPlayer, int depth, int alpha, int beta, int ply);
+
+	/**
+	 * @brief Computes the accumulator of the next ply, if the network is used.
+	 *
+	 * @param gameMap The game board after the move.
+	 * @param move The played move or pass.
+	 * @param ply Distance of the position before the move from the root.
+	 */
+	void UpdateAccumulator(const HiveBoard& gameMap, const Move& move, int ply) {
+		if (network != nullptr) {
+			network->Update(gameMap, move, accumulators[ply], accumulators[ply + 1]);
+		}
+	}
+
+	/**
+	 * @brief Get the hash of the position including the player on turn.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @return std::uint64_t
+	 */
+	static std::uint64_t GetPositionKey(const HiveBoard& gameMap, int IDOfPlayer) {
+		return gameMap.GetHash() ^ (IDOfPlayer == 0 ? 0 : SIDE_TO_MOVE_KEY);
+	}
+
+	/**
+	 * @brief Converts win score relative to the root into score relative to the node for the transposition table.
+	 *
+	 * @param score The score relative to the root.
+	 * @param ply Distance of the node from the root.
+	 * @return int
+	 */
+	static int ScoreToTable(int score, int ply);
+
+	/**
+	 * @brief Converts score from the transposition table into score relative to the root.
+	 *
+	 * @param score The score relative to the node.
+	 * @param ply Distance of the node from the root.
+	 * @return int
+	 */
+	static int ScoreFromTable(int score, int ply);
+
+	std::vector<transpositionEntry> transpositionTable;     /**< Transposition table indexed by the low bits of key. */
+	std::array<killerMoves, MAX_PLY> killers;               /**< Killer moves of every ply, the newest first. */
+	std::array<MovePicker::Buffers, MAX_PLY> pickerBuffers; /**< Generated moves of every ply. */
+	MoveHistory history;                                    /**< History of moves which caused cutoffs. */
+	const NnueNetwork* network;                             /**< The network evaluating leaves or nullptr. */
+	const Tablebase* tablebase;                             /**< The endgame tables or nullptr. */
+	std::vector<nnueAccumulator> accumulators;              /**< Accumulators of the network for every ply. */
+	Move rootBestMove;                                      /**< The best move found at the root. */
+	int lastScore = 0;                                      /**< The score of the last finished iteration. */
+	long long nodesCount = 0;                               /**< Number of visited nodes. */
+};
+
+#endif  // !SEARCH_H
@@ -0,0 +1,176 @@
+#include "SurroundSolver.h"
+
+#include <algorithm>
+#include <bit>
+
+SurroundSolver::SurroundSolver(size_t memoryLimitBytes)
+    : table(std::bit_floor(std::max(memoryLimitBytes / sizeof(proofEntry) / BUCKET_SIZE, (size_t)1)) * BUCKET_SIZE) {}
+
+void SurroundSolver::Clear() { std::fill(table.begin(), table.end(), proofEntry()); }
+
+SurroundSolver::Result SurroundSolver::Solve(const HiveBoard& gameMap, int IDOfPlayer, int maxPlies,
+                                             long long maxNodes) {
+	HiveBoard board = gameMap;
+	attackerId = IDOfPlayer;
+	nodesCount = 0;
+	nodesLimit = maxNodes;
+	generation++;
+	bestMove = Move();
+	childrenStack.resize(std::max(maxPlies, 0) + 1);
+
+	SearchNode(board, IDOfPlayer, maxPlies, INFINITE_NUMBER, INFINITE_NUMBER);
+
+	std::uint32_t phi, delta;
+	Lookup(GetNodeKey(board, IDOfPlayer, maxPlies), phi, delta);
+	if (phi != 0) {
+		return delta == 0 ? Result::DISPROVEN : Result::UNKNOWN;
+	}
+
+	// Proven OR node has child with proof number 0, that is delta of the AND node
+	if (maxPlies > 0 && !IsTerminal(board, IDOfPlayer, maxPlies, phi, delta)) {
+		auto& children = childrenStack[maxPlies];
+		GenerateChildren(board, IDOfPlayer, maxPlies, children);
+		for (const auto& child : children) {
+			GetChildNumbers(child, phi, delta);
+			if (delta == 0) {
+				bestMove = child.move;
+				break;
+			}
+		}
+	}
+	return Result::PROVEN;
+}
+
+void SurroundSolver::SearchNode(HiveBoard& gameMap, int IDOfPlayer, int depth, std::uint32_t thresholdPhi,
+                                std::uint32_t thresholdDelta) {
+	auto startNodesCount = nodesCount++;
+	auto key = GetNodeKey(gameMap, IDOfPlayer, depth);
+	std::uint32_t phi, delta;
+	if (IsTerminal(gameMap, IDOfPlayer, depth, phi, delta)) {
+		Store(key, phi, delta, 1);
+		return;
+	}
+
+	// Only one node of every depth is searched at a time, so the buffer of the depth is free
+	auto& children = childrenStack[depth];
+	GenerateChildren(gameMap, IDOfPlayer, depth, children);
+	if (children.empty()) {
+		// Nobody can move, game ends in draw
+		SetDecided(IDOfPlayer, false, phi, delta);
+		Store(key, phi, delta, 1);
+		return;
+	}
+
+	int opponentId = (IDOfPlayer + 1) % 2;
+	while (true) {
+		// Phi of the node is the smallest delta of children, delta of the node is the sum of phi of children
+		phi = INFINITE_NUMBER;
+		delta = 0;
+		size_t bestChild = 0;
+		std::uint32_t bestChildPhi = 0;
+		std::uint32_t secondDelta = INFINITE_NUMBER;
+		for (size_t i = 0; i < children.size(); i++) {
+			std::uint32_t childPhi, childDelta;
+			GetChildNumbers(children[i], childPhi, childDelta);
+			delta = std::min(delta + childPhi, INFINITE_NUMBER);
+			if (childDelta < phi) {
+				secondDelta = phi;
+				phi = childDelta;
+				bestChild = i;
+				bestChildPhi = childPhi;
+			} else if (childDelta < secondDelta) {
+				secondDelta = childDelta;
+			}
+		}
+		if (phi >= thresholdPhi || delta >= thresholdDelta || nodesCount >= nodesLimit) {
+			break;
+		}
+
+		auto childThresholdPhi =
+		    (std::uint32_t)std::min<std::uint64_t>((std::uint64_t)thresholdDelta - delta + bestChildPhi, INFINITE_NUMBER);
+		auto childThresholdDelta = std::min(thresholdPhi, secondDelta + 1);
+
+		// Decided children never get here, their delta is 0 or they are all INFINITE_NUMBER
+		const auto& move = children[bestChild].move;
+		if (move.piece != NO_PIECE) {
+			gameMap.MakeMove(move);
+		}
+		SearchNode(gameMap, opponentId, depth - 1, childThresholdPhi, childThresholdDelta);
+		if (move.piece != NO_PIECE) {
+			gameMap.UndoMove(move);
+		}
+	}
+	Store(key, phi, delta, (std::uint32_t)std::min<long long>(nodesCount - startNodesCount, INFINITE_NUMBER));
+}
+
+void SurroundSolver::GenerateChildren(HiveBoard& gameMap, int IDOfPlayer, int depth, std::vector<childNode>& children) {
+	children.clear();
+	int opponentId = (IDOfPlayer + 1) % 2;
+
+	MovePicker picker(gameMap, IDOfPlayer, Move(), killerMoves(), history, pickerBuffers);
+	Move move;
+	while (picker.Next(move)) {
+		gameMap.MakeMove(move);
+		childNode child = { move, GetNodeKey(gameMap, opponentId, depth - 1), false, 1, 1 };
+		child.isDecided = IsTerminal(gameMap, opponentId, depth - 1, child.phi, child.delta);
+		gameMap.UndoMove(move);
+		children.push_back(child);
+	}
+
+	// Player without any legal move passes, if the opponent can move
+	if (children.empty() && HasAnyLegalMove(gameMap, opponentId)) {
+		childNode child = { Move(), GetNodeKey(gameMap, opponentId, depth - 1), false, 1, 1 };
+		child.isDecided = IsTerminal(gameMap, opponentId, depth - 1, child.phi, child.delta);
+		children.push_back(child);
+	}
+}
+
+bool SurroundSolver::IsTerminal(const HiveBoard& gameMap, int IDOfPlayer, int depth, std::uint32_t& phi,
+                                std::uint32_t& delta) const {
+	if (gameMap.IsQueenSurrounded(attackerId)) {
+		SetDecided(IDOfPlayer, false, phi, delta);
+		return true;
+	}
+	if (gameMap.IsQueenSurrounded((attackerId + 1) % 2)) {
+		SetDecided(IDOfPlayer, true, phi, delta);
+		return true;
+	}
+	if (depth <= 0) {
+		SetDecided(IDOfPlayer, false, phi, delta);
+		return true;
+	}
+	return false;
+}
+
+void SurroundSolver::Lookup(std::uint64_t key, std::uint32_t& phi, std::uint32_t& delta) const {
+	auto bucket = table.begin() + (key & (table.size() / BUCKET_SIZE - 1)) * BUCKET_SIZE;
+	for (auto entry = bucket; entry != bucket + BUCKET_SIZE; entry++) {
+		if (entry->key == key) {
+			phi = entry->phi;
+			delta = entry->delta;
+			return;
+		}
+	}
+	phi = 1;
+	delta = 1;
+}
+
+void SurroundSolver::Store(std::uint64_t key, std::uint32_t phi, std::uint32_t delta, std::uint32_t work) {
+	auto bucket = table.begin() + (key & (table.size() / BUCKET_SIZE - 1)) * BUCKET_SIZE;
+	auto victim = bucket;
+	for (auto entry = bucket; entry != bucket + BUCKET_SIZE; entry++) {
+		if (entry->key == key) {
+			// Work of the node accumulates over all its visits
+			work = (std::uint32_t)std::min<std::uint64_t>((std::uint64_t)entry->work + work, INFINITE_NUMBER);
+			victim = entry;
+			break;
+		}
+		// Entries of previous calls stay valid, but the current search needs the space more
+		bool isEntryStale = entry->generation != generation;
+		bool isVictimStale = victim->generation != generation;
+		if (isEntryStale > isVictimStale || (isEntryStale == isVictimStale && entry->work < victim->work)) {
+			victim = entry;
+		}
+	}
+	*victim = { key, phi, delta, work, generation };
+}
@@ -0,0 +1,225 @@
+/**
+ * @file SurroundSolver.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the proof-number solver of forced Queen surrounds
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SURROUND_SOLVER_H
+#define SURROUND_SOLVER_H
+
+#include "HiveBoard.h"
+#include "MovePicker.h"
+#include "common.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Proves or disproves, that the player on turn can surround the opponent's Queen within given number of plies.
+ *
+ * Uses depth-first proof-number search (df-pn). Nodes where the attacker is on turn are OR nodes, nodes of the defender
+ * are AND nodes. Attacker wins when the defender's Queen is surrounded and his own isn't, every other end of the game
+ * and running out of plies is a loss. Proof and disproof numbers are kept in table keyed by Zobrist hash of the
+ * position, player on turn and remaining plies, whose size is bounded by the given memory limit.
+ */
+class SurroundSolver {
+public:
+	/**
+	 * @brief Result of the solver.
+	 */
+	enum class Result {
+		PROVEN,    /**< The attacker surely surrounds the Queen. */
+		DISPROVEN, /**< The defender can avoid it. */
+		UNKNOWN    /**< The node limit was reached first. */
+	};
+
+	/**
+	 * @brief Constructs a new SurroundSolver object.
+	 *
+	 * @param memoryLimitBytes Upper bound of the size of the proof table.
+	 */
+	explicit SurroundSolver(size_t memoryLimitBytes = (size_t)64 << 20);
+
+	/**
+	 * @brief Solves the position.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the attacker, who is on turn.
+	 * @param maxPlies Maximal number of plies of both players until the Queen is surrounded.
+	 * @param maxNodes Maximal number of visited nodes.
+	 * @return Result
+	 */
+	Result Solve(const HiveBoard& gameMap, int IDOfPlayer, int maxPlies,
+	             long long maxNodes = std::numeric_limits<long long>::max());
+
+	/**
+	 * @brief Get the first move of the proof of the last solved position.
+	 *
+	 * @return The winning move, or move with piece NO_PIECE if the position wasn't proven or the attacker has to pass.
+	 */
+	const Move& GetBestMove() const { return bestMove; }
+
+	/**
+	 * @brief Get the number of nodes visited by the last call of Solve.
+	 *
+	 * @return long long
+	 */
+	long long GetNodesCount() const { return nodesCount; }
+
+	/**
+	 * @brief Clears the proof table.
+	 */
+	void Clear();
+
+private:
+	static constexpr std::uint32_t INFINITE_NUMBER = 1u << 30;               /**< Proof number of disproven node. */
+	static constexpr std::uint64_t SIDE_TO_MOVE_KEY = 0x9E3779B97F4A7C15ull; /**< Hash key of the second player. */
+	static constexpr std::uint64_t ATTACKER_KEY = 0xC2B2AE3D27D4EB4Full;    /**< Hash key of the second attacker. */
+	static constexpr std::uint64_t DEPTH_KEY = 0xD6E8FEB86659FD93ull;       /**< Hash key of one remaining ply. */
+	static constexpr size_t BUCKET_SIZE = 4; /**< Number of entries sharing one index of the proof table. */
+
+	/**
+	 * @brief Entry of the proof table.
+	 *
+	 * Numbers are stored as phi and delta: proof and disproof number in OR node, disproof and proof number in AND node.
+	 */
+	struct proofEntry {
+		std::uint64_t key = 0;        /**< Key of the node, 0 for empty entry. */
+		std::uint32_t phi = 1;        /**< Number of the player on turn. */
+		std::uint32_t delta = 1;      /**< Number of the player waiting. */
+		std::uint32_t work = 0;       /**< Number of nodes visited under the node, decides which entry is replaced. */
+		std::uint32_t generation = 0; /**< Number of the call of Solve which stored the entry. */
+	};
+
+	/**
+	 * @brief Child of the searched node.
+	 */
+	struct childNode {
+		Move move;           /**< The move leading to the child, pass has piece NO_PIECE. */
+		std::uint64_t key;   /**< Key of the child. */
+		bool isDecided;      /**< Flag indicating if the child is decided by the end of the game or depth. */
+		std::uint32_t phi;   /**< Phi of the decided child. */
+		std::uint32_t delta; /**< Delta of the decided child. */
+	};
+
+	/**
+	 * @brief Searches the node until its numbers reach the thresholds.
+	 *
+	 * @param gameMap The game board, it is restored before returning.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param depth Remaining plies.
+	 * @param thresholdPhi Threshold of phi.
+	 * @param thresholdDelta Threshold of delta.
+	 */
+	void SearchNode(HiveBoard& gameMap, int IDOfPlayer, int depth, std::uint32_t thresholdPhi,
+	                std::uint32_t thresholdDelta);
+
+	/**
+	 * @brief Generates children of the node.
+	 *
+	 * Children decided by the end of the game or depth keep their numbers, so they never depend on the table.
+	 *
+	 * @param gameMap The game board, it is restored before returning.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param depth Remaining plies.
+	 * @param children The generated children.
+	 */
+	void GenerateChildren(HiveBoard& gameMap, int IDOfPlayer, int depth, std::vector<childNode>& children);
+
+	/**
+	 * @brief Checks if the node is decided without searching it.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param depth Remaining plies.
+	 * @param phi Phi of the decided node.
+	 * @param delta Delta of the decided node.
+	 * @return True if the node is decided, false otherwise.
+	 */
+	bool IsTerminal(const HiveBoard& gameMap, int IDOfPlayer, int depth, std::uint32_t& phi,
+	                std::uint32_t& delta) const;
+
+	/**
+	 * @brief Sets phi and delta of the node decided for the attacker or the defender.
+	 *
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param isProven True if the attacker wins, false otherwise.
+	 * @param phi Phi of the node.
+	 * @param delta Delta of the node.
+	 */
+	void SetDecided(int IDOfPlayer, bool isProven, std::uint32_t& phi, std::uint32_t& delta) const {
+		bool isOrNode = IDOfPlayer == attackerId;
+		phi = isOrNode == isProven ? 0 : INFINITE_NUMBER;
+		delta = isOrNode == isProven ? INFINITE_NUMBER : 0;
+	}
+
+	/**
+	 * @brief Get the key of the node.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param depth Remaining plies.
+	 * @return std::uint64_t
+	 */
+	std::uint64_t GetNodeKey(const HiveBoard& gameMap, int IDOfPlayer, int depth) const {
+		return gameMap.GetHash() ^ (IDOfPlayer == 0 ? 0 : SIDE_TO_MOVE_KEY) ^ (attackerId == 0 ? 0 : ATTACKER_KEY) ^
+		       ((std::uint64_t)(depth + 1) * DEPTH_KEY);
+	}
+
+	/**
+	 * @brief Get numbers of the child.
+	 *
+	 * @param child The child.
+	 * @param phi Phi of the child.
+	 * @param delta Delta of the child.
+	 */
+	void GetChildNumbers(const childNode& child, std::uint32_t& phi, std::uint32_t& delta) const {
+		if (child.isDecided) {
+			phi = child.phi;
+			delta = child.delta;
+		} else {
+			Lookup(child.key, phi, delta);
+		}
+	}
+
+	/**
+	 * @brief Reads numbers of the node from the table.
+	 *
+	 * @param key The key of the node.
+	 * @param phi Phi of the node, 1 if it isn't in the table.
+	 * @param delta Delta of the node, 1 if it isn't in the table.
+	 */
+	void Lookup(std::uint64_t key, std::uint32_t& phi, std::uint32_t& delta) const;
+
+	/**
+	 * @brief Stores numbers of the node into the table.
+	 *
+	 * The entry of the node is updated if it is in the bucket, otherwise entry left by previous call of Solve or the
+	 * entry with the least work is replaced. The node is always stored, so the parent sees numbers of the child it has
+	 * just searched and makes progress even when the table is full, and siblings sharing the index don't evict each
+	 * other.
+	 *
+	 * @param key The key of the node.
+	 * @param phi Phi of the node.
+	 * @param delta Delta of the node.
+	 * @param work Number of nodes visited under the node.
+	 */
+	void Store(std::uint64_t key, std::uint32_t phi, std::uint32_t delta, std::uint32_t work);
+
+	std::vector<proofEntry> table; /**< The proof table, buckets of BUCKET_SIZE entries indexed by the low bits of key. */
+	std::vector<std::vector<childNode>> childrenStack;          /**< Buffers of children for every remaining depth. */
+	int attackerId = 0;                                         /**< The ID of the attacker. */
+	long long nodesCount = 0;                                   /**< Number of visited nodes. */
+	long long nodesLimit = std::numeric_limits<long long>::max(); /**< Maximal number of visited nodes. */
+	std::uint32_t generation = 0;                               /**< Number of the current call of Solve. */
+	MoveHistory history; /**< Empty history, moves are ordered only by the Queen priority of MovePicker. */
+	MovePicker::Buffers pickerBuffers; /**< Generated moves, shared by all depths as pickers finish before recursing. */
+	Move bestMove;                     /**< First move of the last proof. */
+};
+
+#endif  // !SURROUND_SOLVER_H
@@ -0,0 +1,167 @@
+#include "Tablebase.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+// GDI and USER declarations collide with names of raylib
+#	define WIN32_LEAN_AND_MEAN
+#	define NOGDI
+#	define NOUSER
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+Tablebase Tablebase::defaultTablebase;
+
+/**
+ * @brief Maps the whole file into memory for reading.
+ *
+ * @param path The path to the file.
+ * @param size Size of the mapped file.
+ * @return Start of the mapped file.
+ * @throws std::runtime_error If the file can't be mapped.
+ */
+static void* MapFile(const std::string& path, size_t& size) {
+#if defined(_WIN32)
+	auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+	                        nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error("Can't open tablebase file " + path);
+	}
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(file, &fileSize);
+	size = (size_t)fileSize.QuadPart;
+	auto mapping = size == 0 ? nullptr : CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	// View keeps the mapping alive after the handles are closed
+	void* view = mapping == nullptr ? nullptr : MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (mapping != nullptr) {
+		CloseHandle(mapping);
+	}
+	CloseHandle(file);
+#else
+	int file = open(path.c_str(), O_RDONLY);
+	if (file == -1) {
+		throw std::runtime_error("Can't open tablebase file " + path);
+	}
+	struct stat fileStatus;
+	fstat(file, &fileStatus);
+	size = (size_t)fileStatus.st_size;
+	void* view = size == 0 ? MAP_FAILED : mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+	// Mapping stays valid after the file is closed
+	close(file);
+	if (view == MAP_FAILED) {
+		view = nullptr;
+	}
+#endif
+	if (view == nullptr) {
+		throw std::runtime_error("Can't map tablebase file " + path);
+	}
+	return view;
+}
+
+/**
+ * @brief Unmaps the file mapped by MapFile.
+ *
+ * @param view Start of the mapped file.
+ * @param size Size of the mapped file.
+ */
+static void UnmapFile(void* view, size_t size) {
+#if defined(_WIN32)
+	UnmapViewOfFile(view);
+#else
+	munmap(view, size);
+#endif
+}
+
+Tablebase::~Tablebase() {
+	for (const auto& table : tables) {
+		UnmapFile(table.view, table.size);
+	}
+}
+
+void Tablebase::Load(const std::string& path) {
+	size_t size;
+	void* view = MapFile(path, size);
+	const auto* header = (const std::uint32_t*)view;
+	constexpr size_t HEADER_SIZE = 4;
+
+	bool isValid = size >= HEADER_SIZE * sizeof(std::uint32_t) && header[0] == FILE_MAGIC &&
+	               header[1] == FILE_VERSION && header[3] < 32 &&
+	               size == (HEADER_SIZE + ((size_t)1 << header[3])) * sizeof(std::uint32_t);
+	if (!isValid || tableOfMaterial.contains(header[2])) {
+		UnmapFile(view, size);
+		throw std::runtime_error(isValid ? "Tablebase file " + path + " repeats loaded material"
+		                                 : "Tablebase file " + path + " isn't valid table");
+	}
+
+	tableOfMaterial[header[2]] = tables.size();
+	tables.push_back({ header + HEADER_SIZE, ((std::uint32_t)1 << header[3]) - 1, view, size });
+}
+
+bool Tablebase::Probe(const HiveBoard& gameMap, int IDOfPlayer, Result& result) const {
+	if (gameMap.HasPieceInHand(0) || gameMap.HasPieceInHand(1)) {
+		return false;
+	}
+	auto tableIndex = tableOfMaterial.find(GetMaterial(gameMap));
+	if (tableIndex == tableOfMaterial.end()) {
+		return false;
+	}
+
+	const auto& table = tables[tableIndex->second];
+	auto key = GetCanonicalKey(gameMap, IDOfPlayer);
+	auto fingerprint = GetFingerprint(key);
+	result = Result::DRAW;
+	for (auto slot = (std::uint32_t)key & table.slotsMask; table.slots[slot] != 0; slot = (slot + 1) & table.slotsMask) {
+		if ((table.slots[slot] & ~RESULT_MASK) == fingerprint) {
+			result = (Result)(table.slots[slot] & RESULT_MASK);
+			break;
+		}
+	}
+	return true;
+}
+
+std::uint64_t Tablebase::GetCanonicalKey(const HiveBoard& gameMap, int IDOfPlayer) {
+	const auto& anchor = gameMap.GetPositionOfPiece(MakePieceId(0, 0, 0));
+	std::array<std::uint64_t, SYMMETRIES_COUNT> keys = {};
+	for (int piece = 0; piece < PIECES_COUNT; piece++) {
+		if (!gameMap.IsPieceOnBoard((pieceId)piece)) {
+			continue;
+		}
+		auto cords = gameMap.GetPositionOfPiece((pieceId)piece) - anchor;
+		auto pieceUnder = gameMap.GetPieceUnder((pieceId)piece);
+		for (int symmetry = 0; symmetry < SYMMETRIES_COUNT; symmetry++) {
+			keys[symmetry] ^= HiveBoard::GetZobristKey((pieceId)piece, GetSymmetricCords(cords, symmetry), pieceUnder);
+		}
+	}
+	return *std::min_element(keys.begin(), keys.end()) ^ (IDOfPlayer == 0 ? 0 : SIDE_TO_MOVE_KEY);
+}
+
+void Tablebase::Save(const std::string& path, std::uint32_t material, const std::vector<decidedPosition>& positions) {
+	// Table is atmost half full, so probes of missing positions stop quickly
+	auto slotsCount = std::bit_ceil(std::max<size_t>(positions.size() * 2, 1));
+	std::vector<std::uint32_t> slots(slotsCount, 0);
+	for (const auto& position : positions) {
+		auto slot = (size_t)position.key & (slotsCount - 1);
+		while (slots[slot] != 0) {
+			slot = (slot + 1) & (slotsCount - 1);
+		}
+		slots[slot] = GetFingerprint(position.key) | (std::uint32_t)position.result;
+	}
+
+	std::ofstream file(path, std::ios::binary);
+	std::array<std::uint32_t, 4> header = { FILE_MAGIC, FILE_VERSION, material,
+		                                    (std::uint32_t)std::countr_zero(slotsCount) };
+	file.write((const char*)header.data(), sizeof(header));
+	file.write((const char*)slots.data(), (std::streamsize)(slots.size() * sizeof(std::uint32_t)));
+	if (!file) {
+		throw std::runtime_error("Can't write tablebase file " + path);
+	}
+}
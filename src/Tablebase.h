@@ -0,0 +1,204 @@
+/**
+ * @file Tablebase.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the memory-mapped win/draw/loss tables of endgames with reduced material
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include "HiveBoard.h"
+#include "bugTiles.h"
+#include "common.h"
+#include "hexUtilities.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Results of perfect play in endgames with few pieces on the board and nothing in hands.
+ *
+ * Every table covers one material, that is both Queens and up to MAX_EXTRA_PIECES other pieces, and is generated by
+ * TablebaseGenerator. Positions are identified by canonical key, which is the same for all translations, rotations and
+ * reflections of the position. The table is open-addressing hash table of 32-bit slots indexed by low bits of the key,
+ * every slot holds high bits of the key and the result for the player on turn. Only won and lost positions are stored,
+ * missing position is a draw.
+ *
+ * Files are memory-mapped, so loading costs nothing and the tables share memory between processes. Probing computes key
+ * over the 12 symmetries of the position and reads few neighboring slots, so it costs O(1).
+ *
+ * The tablebase is an API for studies and analysis. Hive has no captures, so in a played game the hands are empty only
+ * after all PIECES_COUNT pieces are placed, far more than any table covers. Tables answer only positions with reduced
+ * material built by HiveBoard::ClearHands, the interactive game doesn't load them.
+ */
+class Tablebase {
+public:
+	/**
+	 * @brief Result of the position for the player on turn.
+	 */
+	enum class Result : std::uint8_t {
+		WIN = 1,  /**< The player on turn surrounds the opponent's Queen. */
+		DRAW = 2, /**< Neither player can force the surround. */
+		LOSS = 3  /**< The opponent surrounds the Queen of the player on turn. */
+	};
+
+	/**
+	 * @brief Position with known result, the input of Save.
+	 */
+	struct decidedPosition {
+		std::uint64_t key; /**< Canonical key of the position. */
+		Result result;     /**< Result for the player on turn. */
+	};
+
+	static constexpr int MAX_EXTRA_PIECES = 5;                    /**< Maximal number of pieces besides both Queens. */
+	static constexpr int MAX_PIECES = MAX_EXTRA_PIECES + 2;       /**< Maximal number of pieces on the board. */
+	static constexpr int SYMMETRIES_COUNT = 12;                   /**< 6 rotations, each with and without reflection. */
+	static constexpr std::uint32_t FILE_MAGIC = 0x31425448;       /**< "HTB1" at the start of the table file. */
+	static constexpr std::uint32_t FILE_VERSION = 1;              /**< Version of the table file. */
+	static constexpr std::uint32_t RESULT_MASK = 3;               /**< Bits of the slot holding the result. */
+	static constexpr std::uint64_t SIDE_TO_MOVE_KEY = 0x9E3779B97F4A7C15ull; /**< Hash key of the second player. */
+
+	/**
+	 * @brief Constructs an empty Tablebase object.
+	 */
+	Tablebase() = default;
+
+	Tablebase(const Tablebase&) = delete;
+	Tablebase& operator=(const Tablebase&) = delete;
+
+	/**
+	 * @brief Destroys the Tablebase object, unmapping all its files.
+	 */
+	~Tablebase();
+
+	/**
+	 * @brief Maps the table file into memory.
+	 *
+	 * File contains little-endian magic, version, material and binary logarithm of the number of slots as 32-bit
+	 * integers, followed by the 32-bit slots.
+	 *
+	 * @param path The path to the file.
+	 * @throws std::runtime_error If the file can't be mapped or isn't valid table.
+	 */
+	void Load(const std::string& path);
+
+	/**
+	 * @brief Checks if some table has been loaded.
+	 *
+	 * @return True if the tablebase can be probed, false otherwise.
+	 */
+	bool IsLoaded() const { return !tables.empty(); }
+
+	/**
+	 * @brief Looks up the result of the position.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param result The result for the player on turn, valid only if true is returned.
+	 * @return True if table of the material is loaded and nothing is in hands, false otherwise. Hands are empty only in
+	 *         study positions built by HiveBoard::ClearHands, never before the end of a played game.
+	 */
+	bool Probe(const HiveBoard& gameMap, int IDOfPlayer, Result& result) const;
+
+	/**
+	 * @brief Get the material of the position.
+	 *
+	 * @param gameMap The game board.
+	 * @return Mask with bit set for every piece on the board.
+	 */
+	static std::uint32_t GetMaterial(const HiveBoard& gameMap) {
+		std::uint32_t material = 0;
+		for (int piece = 0; piece < PIECES_COUNT; piece++) {
+			material |= (std::uint32_t)gameMap.IsPieceOnBoard((pieceId)piece) << piece;
+		}
+		return material;
+	}
+
+	/**
+	 * @brief Get the key of the position, that is the same for all its translations, rotations and reflections.
+	 *
+	 * Coordinates are taken relative to the Queen of the first player, so she must be on the board. Key is the smallest
+	 * Zobrist hash over all symmetries.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @return std::uint64_t
+	 */
+	static std::uint64_t GetCanonicalKey(const HiveBoard& gameMap, int IDOfPlayer);
+
+	/**
+	 * @brief Get the coordinates mapped by the symmetry of the grid fixing (0, 0).
+	 *
+	 * @param cords The coordinates.
+	 * @param symmetry Number of rotations by 60 degrees, plus 6 if the coordinates are reflected first.
+	 * @return HexCords
+	 */
+	static HexCords GetSymmetricCords(HexCords cords, int symmetry) {
+		if (symmetry >= SYMMETRIES_COUNT / 2) {
+			cords = { cords.r, cords.q };
+		}
+		for (int i = 0; i < symmetry % (SYMMETRIES_COUNT / 2); i++) {
+			cords = { -cords.r, cords.q + cords.r };
+		}
+		return cords;
+	}
+
+	/**
+	 * @brief Writes the table of the material.
+	 *
+	 * @param path The path to the file.
+	 * @param material Mask of the pieces on the board, it must contain both Queens.
+	 * @param positions All won and lost positions of the material.
+	 * @throws std::runtime_error If the file can't be written.
+	 */
+	static void Save(const std::string& path, std::uint32_t material, const std::vector<decidedPosition>& positions);
+
+	/**
+	 * @brief Get the tablebase loaded by LoadDefault, it is used by Search by default.
+	 *
+	 * @return Pointer to the tablebase or nullptr if no table has been loaded.
+	 */
+	static const Tablebase* GetDefault() { return defaultTablebase.IsLoaded() ? &defaultTablebase : nullptr; }
+
+	/**
+	 * @brief Loads the table into the tablebase returned by GetDefault.
+	 *
+	 * Called by the analysis creating the Search, nothing loads the tables implicitly.
+	 *
+	 * @param path The path to the table file.
+	 * @throws std::runtime_error If the file can't be mapped or isn't valid table.
+	 */
+	static void LoadDefault(const std::string& path) { defaultTablebase.Load(path); }
+
+private:
+	/**
+	 * @brief One mapped table file.
+	 */
+	struct materialTable {
+		const std::uint32_t* slots; /**< The slots of the hash table. */
+		std::uint32_t slotsMask;    /**< Number of slots minus one. */
+		void* view;                 /**< Start of the mapped file. */
+		size_t size;                /**< Size of the mapped file. */
+	};
+
+	/**
+	 * @brief Get the high bits of the key stored in the slot next to the result.
+	 *
+	 * @param key The canonical key.
+	 * @return std::uint32_t
+	 */
+	static std::uint32_t GetFingerprint(std::uint64_t key) { return (std::uint32_t)(key >> 32) & ~RESULT_MASK; }
+
+	std::vector<materialTable> tables;                        /**< The loaded tables. */
+	std::unordered_map<std::uint32_t, size_t> tableOfMaterial; /**< Index of the table of every loaded material. */
+
+	static Tablebase defaultTablebase; /**< The tablebase loaded by LoadDefault. */
+};
+
+#endif  // !TABLEBASE_H
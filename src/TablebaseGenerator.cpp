@@ -0,0 +1,272 @@
+#include "TablebaseGenerator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+
+/**
+ * @brief Calls function for every index, indices are taken by the threads in blocks.
+ *
+ * @param count Number of indices.
+ * @param threadsCount Number of threads.
+ * @param function Callable taking the index and the index of the thread.
+ */
+template <typename Function>
+static void ParallelFor(size_t count, int threadsCount, Function&& function) {
+	constexpr size_t BLOCK_SIZE = 256;
+	std::atomic<size_t> nextBlock = 0;
+	auto work = [&](int threadIndex) {
+		for (size_t begin = nextBlock.fetch_add(BLOCK_SIZE); begin < count; begin = nextBlock.fetch_add(BLOCK_SIZE)) {
+			for (size_t i = begin; i < std::min(begin + BLOCK_SIZE, count); i++) {
+				function(i, threadIndex);
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int threadIndex = 1; threadIndex < threadsCount; threadIndex++) {
+		threads.emplace_back(work, threadIndex);
+	}
+	work(0);
+	for (auto& thread : threads) {
+		thread.join();
+	}
+}
+
+TablebaseGenerator::TablebaseGenerator(const std::vector<pieceId>& extraPieces, int threadsCount)
+    : pieces({ MakePieceId(0, 0, 0), MakePieceId(1, 0, 0) }), threadsCount(std::max(threadsCount, 1)) {
+	if (extraPieces.size() > Tablebase::MAX_EXTRA_PIECES) {
+		throw std::runtime_error("Tablebase can't have more than " + std::to_string(Tablebase::MAX_EXTRA_PIECES) +
+		                         " pieces besides Queens");
+	}
+	material = (1u << pieces[0]) | (1u << pieces[1]);
+	for (auto piece : extraPieces) {
+		if (piece >= PIECES_COUNT || GetBugTypeOfPiece(piece) == bugType::QUEEN_BEE || ((material >> piece) & 1)) {
+			throw std::runtime_error("Pieces of tablebase must be distinct and must not contain Queen");
+		}
+		material |= 1u << piece;
+		pieces.push_back(piece);
+	}
+}
+
+void TablebaseGenerator::Generate() {
+	EnumeratePositions();
+	BuildGraph();
+	Propagate();
+
+	// Nobody can force the surround from the rest
+	for (auto& result : results) {
+		if (result == UNDECIDED) {
+			result = (std::uint8_t)Tablebase::Result::DRAW;
+		}
+	}
+}
+
+void TablebaseGenerator::Save(const std::string& path) const {
+	std::vector<Tablebase::decidedPosition> decidedPositions;
+	for (size_t node = 0; node < results.size(); node++) {
+		auto result = (Tablebase::Result)results[node].load();
+		if (result != Tablebase::Result::DRAW) {
+			auto key = keys[node / 2] ^ (node % 2 == 0 ? 0 : Tablebase::SIDE_TO_MOVE_KEY);
+			decidedPositions.push_back({ key, result });
+		}
+	}
+	Tablebase::Save(path, material, decidedPositions);
+}
+
+size_t TablebaseGenerator::GetResultsCount(Tablebase::Result result) const {
+	return (size_t)std::count_if(results.begin(), results.end(),
+	                             [result](const auto& nodeResult) { return nodeResult == (std::uint8_t)result; });
+}
+
+void TablebaseGenerator::EnumeratePositions() {
+	// Every connected hive can be built piece by piece keeping it connected and Queen of the first player on it
+	piecesPlacement start;
+	start[0] = { 0, 0, 0 };
+	std::vector<piecesPlacement> level = { start };
+
+	for (size_t placedCount = 1; placedCount < pieces.size(); placedCount++) {
+		std::vector<piecesPlacement> nextLevel;
+		std::unordered_set<std::uint64_t> visited;
+		std::vector<HexCords> targets;
+		for (const auto& placement : level) {
+			auto gameMap = MakeBoard(placement);
+			for (size_t i = 1; i < pieces.size(); i++) {
+				if (placement[i].height != -1) {
+					continue;
+				}
+
+				// Targets are collected first, because the board changes while they are tried
+				targets.clear();
+				gameMap.ForEachSpaceIn(gameMap.GetBorderOfHive(), [&](const HexCords& cords) { targets.push_back(cords); });
+				if (GetBugTypeOfPiece(pieces[i]) == bugType::BEETLE) {
+					gameMap.ForEachOccupiedTile([&](const HexCords& cords, pieceId) { targets.push_back(cords); });
+				}
+				for (const auto& cords : targets) {
+					gameMap.PlacePiece(pieces[i], cords);
+					if (visited.insert(Tablebase::GetCanonicalKey(gameMap, 0)).second) {
+						nextLevel.push_back(MakePlacement(gameMap));
+					}
+					gameMap.RemovePiece(cords);
+				}
+			}
+		}
+		level = std::move(nextLevel);
+	}
+
+	positions = std::move(level);
+	keys.resize(positions.size());
+	indexOfKey.reserve(positions.size());
+	for (size_t i = 0; i < positions.size(); i++) {
+		keys[i] = Tablebase::GetCanonicalKey(MakeBoard(positions[i]), 0);
+		indexOfKey[keys[i]] = (std::uint32_t)i;
+	}
+}
+
+HiveBoard TablebaseGenerator::MakeBoard(const piecesPlacement& placement) const {
+	HiveBoard gameMap;
+	// Pieces under others have to be placed first
+	for (int height = 0; height < Tablebase::MAX_PIECES; height++) {
+		for (size_t i = 0; i < pieces.size(); i++) {
+			if (placement[i].height == height) {
+				gameMap.PlacePiece(pieces[i], { placement[i].q, placement[i].r });
+			}
+		}
+	}
+	gameMap.ClearHands();
+	return gameMap;
+}
+
+TablebaseGenerator::piecesPlacement TablebaseGenerator::MakePlacement(const HiveBoard& gameMap) const {
+	piecesPlacement placement;
+	for (size_t i = 0; i < pieces.size(); i++) {
+		if (!gameMap.IsPieceOnBoard(pieces[i])) {
+			continue;
+		}
+		const auto& cords = gameMap.GetPositionOfPiece(pieces[i]);
+		std::int8_t height = 0;
+		for (auto under = gameMap.GetPieceUnder(pieces[i]); under != NO_PIECE; under = gameMap.GetPieceUnder(under)) {
+			height++;
+		}
+		placement[i] = { (std::int8_t)cords.q, (std::int8_t)cords.r, height };
+	}
+	return placement;
+}
+
+std::uint8_t TablebaseGenerator::ExpandNode(HiveBoard& gameMap, int IDOfPlayer, std::vector<std::uint32_t>& children,
+                                            MovePicker::Buffers& pickerBuffers) const {
+	children.clear();
+	int opponentId = (IDOfPlayer + 1) % 2;
+	bool isLost = gameMap.IsQueenSurrounded(IDOfPlayer);
+	bool isWon = gameMap.IsQueenSurrounded(opponentId);
+	if (isLost || isWon) {
+		return (std::uint8_t)(isLost && isWon ? Tablebase::Result::DRAW
+		                                      : (isWon ? Tablebase::Result::WIN : Tablebase::Result::LOSS));
+	}
+
+	MovePicker picker(gameMap, IDOfPlayer, Move(), killerMoves(), history, pickerBuffers);
+	Move move;
+	while (picker.Next(move)) {
+		gameMap.MakeMove(move);
+		children.push_back(GetNodeIndex(gameMap, opponentId));
+		gameMap.UndoMove(move);
+	}
+
+	if (children.empty()) {
+		// Player without any legal move passes, game where nobody can move is a draw
+		if (!HasAnyLegalMove(gameMap, opponentId)) {
+			return (std::uint8_t)Tablebase::Result::DRAW;
+		}
+		children.push_back(GetNodeIndex(gameMap, opponentId));
+	}
+
+	// Symmetric moves lead to the same child, it must be counted once
+	std::sort(children.begin(), children.end());
+	children.erase(std::unique(children.begin(), children.end()), children.end());
+	return UNDECIDED;
+}
+
+void TablebaseGenerator::BuildGraph() {
+	size_t nodesCount = positions.size() * 2;
+	results = std::vector<std::atomic<std::uint8_t>>(nodesCount);
+	undecidedChildren = std::vector<std::atomic<std::uint16_t>>(nodesCount);
+	std::vector<std::atomic<std::uint32_t>> predecessorsCount(nodesCount);
+	std::vector<std::vector<std::uint32_t>> threadChildren(threadsCount);
+	std::vector<MovePicker::Buffers> threadPickerBuffers(threadsCount);
+	std::atomic<bool> isComplete = true;
+
+	// Children are generated twice, so only the reversed graph is ever kept in memory
+	ParallelFor(positions.size(), threadsCount, [&](size_t position, int threadIndex) {
+		auto gameMap = MakeBoard(positions[position]);
+		auto& children = threadChildren[threadIndex];
+		for (int player = 0; player < 2; player++) {
+			auto node = position * 2 + player;
+			results[node] = ExpandNode(gameMap, player, children, threadPickerBuffers[threadIndex]);
+			undecidedChildren[node] = (std::uint16_t)children.size();
+			for (auto child : children) {
+				if (child == UINT32_MAX) {
+					isComplete = false;
+					continue;
+				}
+				predecessorsCount[child]++;
+			}
+		}
+	});
+	if (!isComplete) {
+		throw std::runtime_error("Some move of the tablebase leaves the enumerated positions");
+	}
+
+	predecessorsStart.assign(nodesCount + 1, 0);
+	for (size_t node = 0; node < nodesCount; node++) {
+		predecessorsStart[node + 1] = predecessorsStart[node] + predecessorsCount[node];
+		predecessorsCount[node] = 0;
+	}
+	predecessors.resize(predecessorsStart[nodesCount]);
+
+	ParallelFor(positions.size(), threadsCount, [&](size_t position, int threadIndex) {
+		auto gameMap = MakeBoard(positions[position]);
+		auto& children = threadChildren[threadIndex];
+		for (int player = 0; player < 2; player++) {
+			auto node = (std::uint32_t)(position * 2 + player);
+			ExpandNode(gameMap, player, children, threadPickerBuffers[threadIndex]);
+			for (auto child : children) {
+				predecessors[predecessorsStart[child] + predecessorsCount[child]++] = node;
+			}
+		}
+	});
+}
+
+void TablebaseGenerator::Propagate() {
+	std::vector<std::uint32_t> wave;
+	for (size_t node = 0; node < results.size(); node++) {
+		if (results[node] != UNDECIDED && results[node] != (std::uint8_t)Tablebase::Result::DRAW) {
+			wave.push_back((std::uint32_t)node);
+		}
+	}
+
+	std::vector<std::vector<std::uint32_t>> threadWaves(threadsCount);
+	while (!wave.empty()) {
+		ParallelFor(wave.size(), threadsCount, [&](size_t i, int threadIndex) {
+			auto node = wave[i];
+			bool isLost = results[node] == (std::uint8_t)Tablebase::Result::LOSS;
+			for (auto index = predecessorsStart[node]; index < predecessorsStart[node + 1]; index++) {
+				auto predecessor = predecessors[index];
+				// Predecessor is lost only when its last child, that wasn't won, becomes won
+				if (!isLost && undecidedChildren[predecessor].fetch_sub(1) != 1) {
+					continue;
+				}
+				auto expected = UNDECIDED;
+				auto result = isLost ? Tablebase::Result::WIN : Tablebase::Result::LOSS;
+				if (results[predecessor].compare_exchange_strong(expected, (std::uint8_t)result)) {
+					threadWaves[threadIndex].push_back(predecessor);
+				}
+			}
+		});
+
+		wave.clear();
+		for (auto& threadWave : threadWaves) {
+			wave.insert(wave.end(), threadWave.begin(), threadWave.end());
+			threadWave.clear();
+		}
+	}
+}
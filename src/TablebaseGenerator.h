@@ -0,0 +1,169 @@
+/**
+ * @file TablebaseGenerator.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains the retrograde analysis generating tables of Tablebase
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TABLEBASE_GENERATOR_H
+#define TABLEBASE_GENERATOR_H
+
+#include "HiveBoard.h"
+#include "MovePicker.h"
+#include "Tablebase.h"
+#include "common.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Solves all positions of one material by retrograde analysis.
+ *
+ * All connected positions with both Queens and the given pieces on the board are enumerated once per symmetry class,
+ * by adding one piece at a time next to the hive (or on top of it for Beetles) and merging positions with the same
+ * canonical key. Node of the game graph is the position with the player on turn.
+ *
+ * Analysis starts from positions with surrounded Queen. Every decided node decides its predecessors: loss of the player
+ * on turn wins all predecessors, win decreases their counters of undecided children and predecessor with no such child
+ * left is lost. Each wave of newly decided nodes is processed in parallel, nodes never decided are draws. Predecessors
+ * are found in the graph reversed once from generated moves, so the analysis doesn't depend on the rules being
+ * reversible.
+ */
+class TablebaseGenerator {
+public:
+	/**
+	 * @brief Constructs a new TablebaseGenerator object.
+	 *
+	 * @param extraPieces Pieces on the board besides both Queens, atmost Tablebase::MAX_EXTRA_PIECES.
+	 * @param threadsCount Number of threads of the analysis.
+	 * @throws std::runtime_error If the pieces contain Queen, some piece twice or too many pieces.
+	 */
+	explicit TablebaseGenerator(const std::vector<pieceId>& extraPieces,
+	                            int threadsCount = (int)std::max(std::thread::hardware_concurrency(), 1u));
+
+	/**
+	 * @brief Enumerates positions and solves them.
+	 */
+	void Generate();
+
+	/**
+	 * @brief Writes the table of the solved material.
+	 *
+	 * @param path The path to the file.
+	 * @throws std::runtime_error If the file can't be written.
+	 */
+	void Save(const std::string& path) const;
+
+	/**
+	 * @brief Get the number of nodes, that is positions with the player on turn.
+	 *
+	 * @return size_t
+	 */
+	size_t GetNodesCount() const { return results.size(); }
+
+	/**
+	 * @brief Get the number of nodes with the result.
+	 *
+	 * @param result The result for the player on turn.
+	 * @return size_t
+	 */
+	size_t GetResultsCount(Tablebase::Result result) const;
+
+	/**
+	 * @brief Get the material of the generated table.
+	 *
+	 * @return Mask with bit set for every piece on the board.
+	 */
+	std::uint32_t GetMaterial() const { return material; }
+
+private:
+	static constexpr std::uint8_t UNDECIDED = 0; /**< Result of the node, that hasn't been decided yet. */
+
+	/**
+	 * @brief Position of the piece relative to the Queen of the first player.
+	 */
+	struct placedPiece {
+		std::int8_t q = 0;       /**< Q component. */
+		std::int8_t r = 0;       /**< R component. */
+		std::int8_t height = -1; /**< Number of pieces under the piece, -1 if the piece isn't on the board. */
+	};
+
+	using piecesPlacement = std::array<placedPiece, Tablebase::MAX_PIECES>; /**< Placement of pieces in order. */
+
+	/**
+	 * @brief Fills positions with one position of every symmetry class.
+	 */
+	void EnumeratePositions();
+
+	/**
+	 * @brief Builds the board of the placement with empty hands.
+	 *
+	 * @param placement The placement.
+	 * @return HiveBoard
+	 */
+	HiveBoard MakeBoard(const piecesPlacement& placement) const;
+
+	/**
+	 * @brief Get the placement of pieces on the board.
+	 *
+	 * @param gameMap The game board with the Queen of the first player at (0, 0).
+	 * @return piecesPlacement
+	 */
+	piecesPlacement MakePlacement(const HiveBoard& gameMap) const;
+
+	/**
+	 * @brief Decides terminal node or generates its distinct children.
+	 *
+	 * @param gameMap The board of the node, it is restored before returning.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @param children Indices of the children, empty for decided node.
+	 * @param pickerBuffers Generated moves, owned by the thread.
+	 * @return Result of the decided node or UNDECIDED.
+	 */
+	std::uint8_t ExpandNode(HiveBoard& gameMap, int IDOfPlayer, std::vector<std::uint32_t>& children,
+	                        MovePicker::Buffers& pickerBuffers) const;
+
+	/**
+	 * @brief Get the index of the node.
+	 *
+	 * @param gameMap The game board.
+	 * @param IDOfPlayer The ID of the player on turn.
+	 * @return Index of the node or UINT32_MAX if the position wasn't enumerated.
+	 */
+	std::uint32_t GetNodeIndex(const HiveBoard& gameMap, int IDOfPlayer) const {
+		auto position = indexOfKey.find(Tablebase::GetCanonicalKey(gameMap, 0));
+		return position == indexOfKey.end() ? UINT32_MAX : position->second * 2 + IDOfPlayer;
+	}
+
+	/**
+	 * @brief Decides terminal nodes, counts children of the others and builds lists of predecessors.
+	 */
+	void BuildGraph();
+
+	/**
+	 * @brief Propagates results from decided nodes to their predecessors until nothing changes.
+	 */
+	void Propagate();
+
+	std::vector<pieceId> pieces;                            /**< Pieces of the material, both Queens first. */
+	std::uint32_t material = 0;                             /**< Mask of pieces of the material. */
+	int threadsCount;                                       /**< Number of threads of the analysis. */
+	MoveHistory history;                                    /**< Empty history shared by move pickers of all threads. */
+	std::vector<piecesPlacement> positions;                 /**< One position of every symmetry class. */
+	std::vector<std::uint64_t> keys;                        /**< Canonical key of every position, first player on turn. */
+	std::unordered_map<std::uint64_t, std::uint32_t> indexOfKey; /**< Index of the position of every canonical key. */
+	std::vector<std::atomic<std::uint8_t>> results;         /**< Result of every node, index is position * 2 + player. */
+	std::vector<std::atomic<std::uint16_t>> undecidedChildren; /**< Number of children, that aren't won, of every node. */
+	std::vector<std::uint64_t> predecessorsStart;           /**< Start of predecessors of every node in predecessors. */
+	std::vector<std::uint32_t> predecessors;                /**< Predecessors of all nodes, grouped by the node. */
+};
+
+#endif  // !TABLEBASE_GENERATOR_H
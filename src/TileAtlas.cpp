@@ -0,0 +1,44 @@
+#include "TileAtlas.h"
+
+#include <cmath>
+
+void TileAtlas::Load(float hexSize, float lineThickness) {
+	Unload();
+
+	// Tile with a vertex on the x axis is 2 radii wide and sqrt(3) radii high, pixel of margin keeps tiles apart
+	cellSize = Vector2(std::ceil(2 * hexSize) + 2, std::ceil(SQRT_OF_THREE * hexSize) + 2);
+	atlas = LoadRenderTexture((int)cellSize.x * DIFFERENT_PIECES_COUNT, (int)cellSize.y * ROWS_COUNT);
+
+	BeginTextureMode(atlas);
+	ClearBackground(BLANK);
+	for (int playerId = 0; playerId < 2; playerId++) {
+		const auto& playerColors = playerId == 0 ? FIRST_PLAYER_COLORS : SECOND_PLAYER_COLORS;
+		for (const auto& piece : STARTING_PIECES) {
+			for (bool isHighlighted : { false, true }) {
+				auto cell = GetCellPosition(playerId, piece.first, isHighlighted);
+				auto center = Vector2(cell.x + cellSize.x / 2, cell.y + cellSize.y / 2);
+				auto outlineColor = isHighlighted ? HIGHLIGHT_COLOR : playerColors.first;
+				DrawPoly(center, HEXAGON_SIDES_COUNT, hexSize - lineThickness, 0, playerColors.second);
+				DrawPolyLinesEx(center, HEXAGON_SIDES_COUNT, hexSize - lineThickness, 0, lineThickness, outlineColor);
+				DrawPoly(center, HEXAGON_SIDES_COUNT, hexSize / 2, 0, GetColorOfBugType(piece.first));
+			}
+		}
+	}
+	EndTextureMode();
+}
+
+void TileAtlas::Unload() {
+	if (atlas.id != 0) {
+		UnloadRenderTexture(atlas);
+	}
+	atlas = { 0 };
+}
+
+void TileAtlas::Draw(const Vector2& center, int playerId, bugType type, bool isHighlighted) const {
+	auto cell = GetCellPosition(playerId, type, isHighlighted);
+	// Texture is upside down, so the source is taken from the mirrored position with negative height
+	Rectangle source(cell.x, atlas.texture.height - cell.y - cellSize.y, cellSize.x, -cellSize.y);
+	// Whole pixels keep the tile sharp
+	Vector2 position(std::round(center.x - cellSize.x / 2), std::round(center.y - cellSize.y / 2));
+	DrawTextureRec(atlas.texture, source, position, WHITE);
+}
@@ -0,0 +1,80 @@
+/**
+ * @file TileAtlas.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains texture atlas with pre-rendered bug tiles
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TILE_ATLAS_H
+#define TILE_ATLAS_H
+
+#include "bugTiles.h"
+#include "common.h"
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+/**
+ * @brief Every look of the bug tile rendered once into one texture.
+ *
+ * The atlas has a column for every bug type and a row for every player with and without highlighted outline. Tile is
+ * then drawn as one textured quad instead of the filled hexagon, its outline and the smaller hexagon in the middle, and
+ * quads of the same texture are merged by raylib into one draw call. The atlas has to be loaded again whenever the size
+ * of hexagons changes.
+ */
+class TileAtlas {
+public:
+	/**
+	 * @brief Constructs an empty TileAtlas object, Load has to be called once the window exists.
+	 */
+	TileAtlas() = default;
+
+	TileAtlas(const TileAtlas&) = delete;
+	TileAtlas& operator=(const TileAtlas&) = delete;
+
+	/**
+	 * @brief Renders all tiles into the atlas, replacing the previous one.
+	 *
+	 * @param hexSize The size of the hexagons.
+	 * @param lineThickness The thickness of the outline, it lies inside the hexagon.
+	 */
+	void Load(float hexSize, float lineThickness);
+
+	/**
+	 * @brief Releases the texture of the atlas.
+	 */
+	void Unload();
+
+	/**
+	 * @brief Draws the tile centered at the position.
+	 *
+	 * @param center The screen position of the center of the tile.
+	 * @param playerId The ID of the player owning the tile.
+	 * @param type The bug type of the tile.
+	 * @param isHighlighted True for the tile with outline of HIGHLIGHT_COLOR, false for the outline of the player.
+	 */
+	void Draw(const Vector2& center, int playerId, bugType type, bool isHighlighted = false) const;
+
+private:
+	static constexpr int ROWS_COUNT = 4; /**< Both players, each with and without highlight. */
+
+	/**
+	 * @brief Get the position of the top left corner of the tile in the atlas, as it was drawn into.
+	 *
+	 * @param playerId The ID of the player owning the tile.
+	 * @param type The bug type of the tile.
+	 * @param isHighlighted True for the highlighted tile.
+	 * @return Vector2
+	 */
+	Vector2 GetCellPosition(int playerId, bugType type, bool isHighlighted) const {
+		return Vector2((float)type * cellSize.x, (float)(playerId * 2 + isHighlighted) * cellSize.y);
+	}
+
+	RenderTexture2D atlas = { 0 }; /**< The texture with all tiles. */
+	Vector2 cellSize = { 0, 0 };    /**< Size of the part of the atlas taken by one tile. */
+};
+
+#endif  // !TILE_ATLAS_H
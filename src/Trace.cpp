@@ -0,0 +1,80 @@
+#include "Trace.h"
+
+#ifdef HIVE_TRACING
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+const std::chrono::steady_clock::time_point Trace::start = std::chrono::steady_clock::now();
+std::mutex Trace::buffersMutex;
+std::vector<std::unique_ptr<Trace::threadBuffer>> Trace::buffers;
+
+Trace::threadBuffer* Trace::RegisterThread() {
+	std::lock_guard lock(buffersMutex);
+	buffers.push_back(std::make_unique<threadBuffer>());
+	buffers.back()->threadId = (int)buffers.size();
+	return buffers.back().get();
+}
+
+void Trace::Flush(const std::string& path) {
+	std::ofstream file(path);
+	if (!file) {
+		throw std::runtime_error("Can't open trace file " + path);
+	}
+	file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool isFirst = true;
+	std::lock_guard lock(buffersMutex);
+	for (const auto& buffer : buffers) {
+		std::uint64_t writtenCount = buffer->writtenCount.load(std::memory_order_acquire);
+		std::uint64_t first = writtenCount > BUFFER_SIZE ? writtenCount - BUFFER_SIZE : 0;
+
+		struct copiedEvent {
+			const char* name;
+			std::int64_t timestamp;
+			bool isBegin;
+		};
+		std::vector<copiedEvent> events;
+		events.reserve((std::size_t)(writtenCount - first));
+		for (std::uint64_t i = first; i < writtenCount; i++) {
+			const auto& event = buffer->events[i % BUFFER_SIZE];
+			events.push_back({ event.name.load(std::memory_order_relaxed),
+			                   event.timestamp.load(std::memory_order_relaxed),
+			                   event.isBegin.load(std::memory_order_relaxed) });
+		}
+
+		// Thread could have overwritten the oldest copied events meanwhile, fence orders the copying before the check
+		std::atomic_thread_fence(std::memory_order_acquire);
+		std::uint64_t overwrittenCount = buffer->writtenCount.load(std::memory_order_relaxed);
+		// Slot of the next unpublished event may be half written, so the copied event in it is skipped too
+		std::size_t skippedCount = 0;
+		if (overwrittenCount + 1 > BUFFER_SIZE + first) {
+			skippedCount =
+			    (std::size_t)std::min<std::uint64_t>(overwrittenCount + 1 - BUFFER_SIZE - first, events.size());
+		}
+
+		// Ends of spans, whose begins were overwritten, would close unrelated spans
+		int depth = 0;
+		for (std::size_t i = skippedCount; i < events.size(); i++) {
+			const auto& event = events[i];
+			if (!event.isBegin && depth == 0) {
+				continue;
+			}
+			depth += event.isBegin ? 1 : -1;
+
+			file << (isFirst ? "\n" : ",\n") << "{\"name\":\"" << event.name << "\",\"ph\":\""
+			     << (event.isBegin ? 'B' : 'E') << "\",\"ts\":" << (double)event.timestamp / 1000
+			     << ",\"pid\":1,\"tid\":" << buffer->threadId << "}";
+			isFirst = false;
+		}
+	}
+	file << "\n]}\n";
+
+	if (!file) {
+		throw std::runtime_error("Can't write trace file " + path);
+	}
+}
+
+#endif  // HIVE_TRACING
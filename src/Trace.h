@@ -0,0 +1,156 @@
+/**
+ * @file Trace.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains tracing of spans exported as Chrome trace JSON
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+/**
+ * Spans are recorded only when HIVE_TRACING is defined (CMake option HIVE_TRACING), otherwise the macros expand to
+ * nothing and no code of the tracing is compiled.
+ */
+#ifdef HIVE_TRACING
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Records begin and end events of spans and writes them as Chrome trace JSON, readable by Perfetto.
+ *
+ * Every thread records into its own ring buffer, so recording takes no lock, the oldest events are overwritten when
+ * the buffer is full. The buffers outlive their threads, so events of finished threads are written too. Names of
+ * spans are stored as pointers, so they have to be string literals.
+ */
+class Trace {
+public:
+	/**
+	 * @brief Records the span from its construction to its destruction on the current thread.
+	 */
+	class ScopedSpan {
+	public:
+		/**
+		 * @brief Records the begin event of the span.
+		 *
+		 * @param name The name of the span, a string literal.
+		 */
+		explicit ScopedSpan(const char* name) : name(name) { Record(name, true); }
+
+		/**
+		 * @brief Records the end event of the span.
+		 */
+		~ScopedSpan() { Record(name, false); }
+
+		ScopedSpan(const ScopedSpan&) = delete;
+		ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+	private:
+		const char* name; /**< The name of the span. */
+	};
+
+	/**
+	 * @brief Writes the events of all threads as Chrome trace JSON.
+	 *
+	 * Threads can keep recording while the events are written, events overwritten meanwhile are left out.
+	 *
+	 * @param path The path to the written file.
+	 * @throws std::runtime_error If the file can't be written.
+	 */
+	static void Flush(const std::string& path);
+
+private:
+	static constexpr std::size_t BUFFER_SIZE = 1 << 16; /**< Number of events kept for every thread. */
+
+	/**
+	 * @brief Begin or end event of the span.
+	 *
+	 * Fields are atomic, so Flush can read them while the owning thread writes. Relaxed accesses are plain moves.
+	 */
+	struct traceEvent {
+		std::atomic<const char*> name = nullptr; /**< The name of the span. */
+		std::atomic<std::int64_t> timestamp = 0; /**< Nanoseconds since the start of the tracing. */
+		std::atomic<bool> isBegin = false;       /**< True for the begin event, false for the end event. */
+	};
+
+	/**
+	 * @brief Ring buffer of events written by one thread.
+	 */
+	struct threadBuffer {
+		int threadId = 0;                            /**< Id of the thread in the trace, 1 for the first one. */
+		std::atomic<std::uint64_t> writtenCount = 0; /**< Number of events written since the start. */
+		std::array<traceEvent, BUFFER_SIZE> events;  /**< The kept events. */
+	};
+
+	/**
+	 * @brief Records the event into the buffer of the current thread.
+	 *
+	 * @param name The name of the span.
+	 * @param isBegin True for the begin event, false for the end event.
+	 */
+	static void Record(const char* name, bool isBegin) {
+		auto timestamp = std::chrono::steady_clock::now() - start;
+		threadBuffer& buffer = GetThreadBuffer();
+		std::uint64_t index = buffer.writtenCount.load(std::memory_order_relaxed);
+		traceEvent& event = buffer.events[index % BUFFER_SIZE];
+		event.name.store(name, std::memory_order_relaxed);
+		event.timestamp.store(std::chrono::nanoseconds(timestamp).count(), std::memory_order_relaxed);
+		event.isBegin.store(isBegin, std::memory_order_relaxed);
+		// Flush sees the whole event once it sees the count
+		buffer.writtenCount.store(index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Get the buffer of the current thread, it is registered on the first call of the thread.
+	 *
+	 * @return The buffer of the current thread.
+	 */
+	static threadBuffer& GetThreadBuffer() {
+		thread_local threadBuffer* buffer = RegisterThread();
+		return *buffer;
+	}
+
+	/**
+	 * @brief Creates the buffer of the current thread and adds it to the buffers written by Flush.
+	 *
+	 * @return The new buffer.
+	 */
+	static threadBuffer* RegisterThread();
+
+	static const std::chrono::steady_clock::time_point start;   /**< Time of the start of the tracing. */
+	static std::mutex buffersMutex;                             /**< Guards the list of buffers, not their events. */
+	static std::vector<std::unique_ptr<threadBuffer>> buffers; /**< Buffers of all threads that recorded any event. */
+};
+
+#define HIVE_TRACE_CONCAT_INNER(first, second) first##second
+#define HIVE_TRACE_CONCAT(first, second) HIVE_TRACE_CONCAT_INNER(first, second)
+
+/**
+ * @brief Records the span named by the string literal until the end of the current scope.
+ */
+#define TRACE_SCOPE(name) Trace::ScopedSpan HIVE_TRACE_CONCAT(traceSpan, __LINE__)(name)
+
+/**
+ * @brief Writes the recorded events to the file as Chrome trace JSON.
+ */
+#define TRACE_FLUSH(path) Trace::Flush(path)
+
+#else
+
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_FLUSH(path) ((void)0)
+
+#endif  // HIVE_TRACING
+
+#endif  // !TRACE_H
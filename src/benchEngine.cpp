@@ -0,0 +1,203 @@
+#include "common.h"
+#include "Evaluation.h"
+#include "HiveBoard.h"
+#include "MovePicker.h"
+#include "Nnue.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Benchmarks of the engine on positions of random games from a fixed seed, so runs are comparable
+
+static constexpr unsigned RANDOM_SEED = 2024;        /**< Seed of all random positions. */
+static constexpr int RANDOM_GAMES_COUNT = 200;       /**< Number of random games. */
+static constexpr int RANDOM_GAME_PLIES = 80;         /**< Maximal length of random game. */
+static constexpr int REPEATS_COUNT = 20;             /**< Number of passes over all positions of every benchmark. */
+static constexpr int KERNEL_CALLS_COUNT = 1 << 22;   /**< Number of calls of every kernel of the network. */
+static constexpr int KERNEL_ACCUMULATORS_COUNT = 64; /**< Number of accumulators the kernels cycle through. */
+
+using benchPosition = std::pair<HiveBoard, int>; /**< The board and the ID of the player on turn. */
+
+/**
+ * @brief Generates all moves of the player, like the search does when nothing cuts off.
+ *
+ * @param gameMap The game board.
+ * @param IDOfPlayer The ID of the player on turn.
+ * @param buffers Storage of the generated moves.
+ * @param moves The generated moves.
+ */
+static void GenerateAllMoves(const HiveBoard& gameMap, int IDOfPlayer, MovePicker::Buffers& buffers,
+                             std::vector<Move>& moves) {
+	static const MoveHistory history;
+	moves.clear();
+	MovePicker picker(gameMap, IDOfPlayer, Move(), killerMoves(), history, buffers);
+	Move move;
+	while (picker.Next(move)) {
+		moves.push_back(move);
+	}
+}
+
+/**
+ * @brief Collects positions before every move of random games.
+ *
+ * Game ends when some Queen is surrounded, nobody can move or after RANDOM_GAME_PLIES.
+ *
+ * @return The positions.
+ */
+static std::vector<benchPosition> CollectPositions() {
+	std::mt19937 random(RANDOM_SEED);
+	MovePicker::Buffers buffers;
+	std::vector<Move> moves;
+	std::vector<benchPosition> positions;
+	for (int game = 0; game < RANDOM_GAMES_COUNT; game++) {
+		HiveBoard gameMap;
+		int IDOfPlayer = (int)(random() % 2);
+		int passesInRow = 0;
+		for (int ply = 0; ply < RANDOM_GAME_PLIES && passesInRow < 2; ply++) {
+			if (gameMap.IsQueenSurrounded(0) || gameMap.IsQueenSurrounded(1)) {
+				break;
+			}
+			positions.emplace_back(gameMap, IDOfPlayer);
+			GenerateAllMoves(gameMap, IDOfPlayer, buffers, moves);
+			if (!moves.empty()) {
+				gameMap.MakeMove(moves[random() % moves.size()]);
+			}
+			passesInRow = moves.empty() ? passesInRow + 1 : 0;
+			IDOfPlayer = (IDOfPlayer + 1) % 2;
+		}
+	}
+	return positions;
+}
+
+/**
+ * @brief Measures the average time of the function over all positions.
+ *
+ * @param positions The positions.
+ * @param function Callable taking the board and the ID of the player on turn, returning a number, that is summed so
+ *                 the call can't be optimized out.
+ * @return Nanoseconds per position.
+ */
+template <typename Function>
+static double MeasureNanoseconds(const std::vector<benchPosition>& positions, Function&& function) {
+	long long checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int repeat = 0; repeat < REPEATS_COUNT; repeat++) {
+		for (const auto& [gameMap, IDOfPlayer] : positions) {
+			checksum += function(gameMap, IDOfPlayer);
+		}
+	}
+	auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	// Printed checksum keeps the results of the function alive
+	std::cout << "    (checksum " << checksum << ")" << std::endl;
+	return elapsed / ((double)positions.size() * REPEATS_COUNT);
+}
+
+/**
+ * @brief Compares the cost of the static evaluation with the cost of generating all moves of the position.
+ *
+ * @param positions The positions.
+ */
+static void BenchEvaluation(const std::vector<benchPosition>& positions) {
+	std::cout << "Evaluate against generation of all moves" << std::endl;
+	MovePicker::Buffers buffers;
+	std::vector<Move> moves;
+	double generation = MeasureNanoseconds(positions, [&](const HiveBoard& gameMap, int IDOfPlayer) {
+		GenerateAllMoves(gameMap, IDOfPlayer, buffers, moves);
+		return (long long)moves.size();
+	});
+	double evaluation = MeasureNanoseconds(
+	    positions, [](const HiveBoard& gameMap, int IDOfPlayer) { return (long long)Evaluate(gameMap, IDOfPlayer); });
+	std::cout << "    generation " << generation << " ns, evaluation " << evaluation << " ns per position, "
+	          << "evaluation costs " << evaluation / generation * 100 << "% of generation" << std::endl;
+}
+
+/**
+ * @brief Measures the average time of the kernel of the network.
+ *
+ * @param kernel Callable taking the index of the call, returning a number, that is summed so the call can't be
+ *               optimized out.
+ * @return Nanoseconds per call.
+ */
+template <typename Kernel>
+static double MeasureKernelNanoseconds(Kernel&& kernel) {
+	long long checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < KERNEL_CALLS_COUNT; i++) {
+		checksum += kernel(i);
+	}
+	auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "    (checksum " << checksum << ")" << std::endl;
+	return elapsed / KERNEL_CALLS_COUNT;
+}
+
+/**
+ * @brief Compares the compiled kernels of the network with the scalar ones.
+ *
+ * Evaluation is the output layer over both views, as NnueNetwork::Evaluate computes it, update is one moved piece in
+ * one view, as NnueNetwork::Update computes it.
+ */
+static void BenchNnueKernels() {
+	constexpr int SIZE = NnueNetwork::HIDDEN_SIZE;
+	std::cout << "Kernels of NnueNetwork (" << NnueNetwork::KERNELS_NAME << ") against the scalar kernels"
+	          << std::endl;
+	// Calls cycle through distinct accumulators, so the compiler can't hoist them out of the loop
+	std::mt19937 random(RANDOM_SEED);
+	std::vector<nnueAccumulator> accumulators(KERNEL_ACCUMULATORS_COUNT);
+	for (auto& accumulator : accumulators) {
+		for (auto& values : accumulator.values) {
+			for (auto& value : values) {
+				value = (std::int16_t)((int)(random() % 256) - 64);
+			}
+		}
+	}
+	alignas(32) std::array<std::int16_t, 2 * SIZE> weights;
+	for (auto& weight : weights) {
+		weight = (std::int16_t)((int)(random() % 201) - 100);
+	}
+
+	auto evaluate = [&](auto dot) {
+		return MeasureKernelNanoseconds([&](int i) {
+			const auto& accumulator = accumulators[i % KERNEL_ACCUMULATORS_COUNT];
+			return (long long)dot(accumulator.values[0].data(), weights.data()) +
+			       dot(accumulator.values[1].data(), weights.data() + SIZE);
+		});
+	};
+	double evaluation = evaluate(NnueNetwork::DotClippedView);
+	double scalarEvaluation = evaluate(NnueNetwork::DotClippedViewScalar);
+
+	auto update = [&](auto apply) {
+		return MeasureKernelNanoseconds([&](int i) {
+			auto& values = accumulators[i % KERNEL_ACCUMULATORS_COUNT].values[0];
+			apply(values.data(), weights.data(), weights.data() + SIZE, values.data());
+			return (long long)values[i % SIZE];
+		});
+	};
+	double updateTime = update(NnueNetwork::ApplyFeatures);
+	double scalarUpdate = update(NnueNetwork::ApplyFeaturesScalar);
+
+	std::cout << "    evaluation " << evaluation << " ns (" << 1000 / evaluation << "M/s), scalar " << scalarEvaluation
+	          << " ns (" << 1000 / scalarEvaluation << "M/s)" << std::endl;
+	std::cout << "    update " << updateTime << " ns, scalar " << scalarUpdate << " ns" << std::endl;
+}
+
+//------------------------------------------------------------------------------------
+// Engine benchmarks entry point
+//------------------------------------------------------------------------------------
+int main() {
+	try {
+		auto positions = CollectPositions();
+		std::cout << positions.size() << " positions of " << RANDOM_GAMES_COUNT << " random games" << std::endl;
+		BenchEvaluation(positions);
+		BenchNnueKernels();
+	} catch (const std::exception& e) {
+		std::cout << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -16,13 +16,17 @@
 #include "raylib.h"
 #include "raymath.h"
 #include "rlgl.h"
+#include "Trace.h"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
-#include <vector>
+#include <utility>
 
 /**
  * @brief Enumeration representing types of bugs in the game.
@@ -36,408 +40,437 @@ enum class bugType {
 };
 
 
+/**
+ * @brief Static data describing single bug piece.
+ */
 struct TileData {
-	TileData(bugType type, Color bugColor, int playerId) : type(type), bugColor(bugColor), playerId(playerId) {}
-	bugType type;
-	Color bugColor;
-	int playerId;
+	constexpr TileData(bugType type, Color bugColor, int playerId) : type(type), bugColor(bugColor), playerId(playerId) {}
+	bugType type;   /**< The type of bug represented by the piece. */
+	Color bugColor; /**< The color of the bug piece. */
+	int playerId;   /**< The ID of the player owning the piece. */
 };
 
 /**
- * @brief Base class representing a bug tile in the game.
+ * @brief Type alias for player piece and his amount, that player has
+ */
+using playerPiece = std::pair<bugType, int>;
+
+/**
+ * @brief Pieces that every player starts with, in the order in which they are shown in the player field.
  *
- * This class provides a base representation for a bug tile in the game. It includes methods
- * for accessing properties of the bug tile and defining common behavior for all bug types.
+ * Index into this array is also index of the piece in the player field.
  */
-class BaseBugTile {
-public:
-	/**
-	 * @brief Constructs a BaseBugTile object.
-	 *
-	 * Constructs a BaseBugTile object with the specified player ID, color, and bug type.
-	 *
-	 * @param playerId The ID of the player owning the bug tile.
-	 * @param color The color of the bug tile.
-	 * @param type The type of bug represented by the tile.
-	 */
-	BaseBugTile(const TileData* const tileData)
-	    : tileData(tileData){}
-
-	/**
-	 * @brief Deleted default constructor.
-	 *
-	 * The default constructor is deleted to prevent instantiation without required parameters.
-	 */
-	BaseBugTile() = delete;
-
-	/**
-	 * @brief Get the Bug Color object
-	 *
-	 * @return const Color&
-	 */
-	const Color& GetBugColor() const { return tileData->bugColor; }
-
-	/**
-	 * @brief Get the Player ID object
-	 *
-	 * @return const int&
-	 */
-	const int& GetPlayerID() const { return tileData->playerId; }
-
-	/**
-	 * @brief Get the Bug Type object
-	 *
-	 * @return const bugType&
-	 */
-	const bugType& GetBugType() const { return tileData->type; }
-
-	/**
-	 * @brief Define rules for moving the bug tile.
-	 *
-	 * This pure virtual function must be implemented by derived classes to define
-	 * the specific movement rules of the bug tile.
-	 * Base rules for all tiles is: The removal must not violate the integrity of the hive.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param originalCords The original coordinates of the bug tile.
-	 * @return A set of HexCords representing the possible moves for the tile.
-	 */
-	virtual possibleMovesSet Move(const hexTileMap& gameMap, const possibleMovesSet& possibleGeneralMoves,
-	                              const HexCords& originalCords) = 0;
-
-	/**
-	 * @brief Define rules for placing the bug tile.
-	 *
-	 * This function return possible places to places the bug tile. It is called when bug tile is placed from player
-	 * hand.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param IDOfPlayer The ID of the player placing the bug tile.
-	 * @param isZeroTurn Flag indicating if it's the zero turn (optional, defaults to false). If set to true rule about
-	 * placing near bug tile with same color doesn't apply
-	 * @return A set of HexCords representing the possible places to place the tile
-	 */
-	possibleMovesSet Place(const hexTileMap& gameMap, const possibleMovesSet& possibleGeneralMoves,
-	                       const int IDOfPlayer, const bool isZeroTurn = false);
-
-	/**
-	 * @brief Virtual destructor for BaseBugTile.
-	 *
-	 * Defines a virtual destructor to allow proper cleanup in derived classes.
-	 */
-	virtual ~BaseBugTile(){};
-
-protected:
-	/**
-	 * @brief Retrieves tiles with atleast one neighbor of same color.
-	 *
-	 * Retrieves tiles from possibleGeneralMoves with atleast one neighbor, that have same ID as IDOfPlayer.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible moves.
-	 * @param IDOfPlayer The ID of the player.
-	 * @return A set of HexCords with atleast one neighbor of same color.
-	 */
-	possibleMovesSet SpacesSurrondedByTheirColor(const hexTileMap& gameMap,
-	                                             const possibleMovesSet& possibleGeneralMoves, const int IDOfPlayer);
-
-	/**
-	 * @brief Checks the integrity of the hive without one tile.
-	 *
-	 * This function checks the integrity of the hive without considering one specific tile.
-	 *
-	 * @param map The game map represented as a hexTileMap.
-	 * @param cordsOfRemovedHex The coordinates of the removed hex tile. Passed as copy intentionally.
-	 * @return True if the hive remains intact after removing the specified tile, false otherwise.
-	 */
-	bool CheckIntegrityOfHiveWithoutOneTile(hexTileMap map, const HexCords& cordsOfRemovedHex);
-
-	/**
-	 * @brief Checks if the bug tile has freedom to move.
-	 *
-	 * This function checks if the bug tile isn't surrounded.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param cordsOfRemovedHex The coordinates of the bug tile.
-	 * @return True if the bug tile has freedom to move, false otherwise.
-	 */
-
-	bool FreedomToMove(const hexTileMap& gameMap, const HexCords& cordsOfRemovedHex);
-
-	/**
-	 * @brief Checks if a tile is surrounded by tiles.
-	 *
-	 * This function checks if a space on the game map is surrounded by atleast 5 tiles.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param cordsOfHex The coordinates of the space.
-	 * @return True if the space is surrounded by tiles, false otherwise.
-	 */
-	bool IsSpaceSurrounded(const hexTileMap& gameMap, const HexCords& cordsOfHex);
-
-	/**
-	 * @brief Removes possible moves around a tile.
-	 *
-	 * This function removes possible moves around a specified tile from a set of possible moves.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleMoves The set of possible moves passed as const reference.
-	 * @param tile The coordinates of the tile.
-	 * @return A set of HexCords representing the possible moves with moves around the tile removed.
-	 */
-	possibleMovesSet RemovePossibleMovesAroundTile(const hexTileMap& gameMap, const possibleMovesSet& possibleMoves,
-	                                               const HexCords& tile);
-
-	/**
-	 * @brief Removes possible moves around a tile.
-	 *
-	 * This function removes possible moves around a specified tile from a set of possible moves.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleMoves The set of possible moves passed as reference.
-	 * @param tile The coordinates of the tile.
-	 * @return A reference to the modified set of possible moves with moves around the tile removed.
-	 */
-	possibleMovesSet& RemovePossibleMovesAroundTile(const hexTileMap& gameMap, possibleMovesSet& possibleMoves,
-	                                                const HexCords& tile);
-
-	/**
-	 * @brief Checks if the game map is clear.
-	 *
-	 * This function checks if the game map is clear, i.e., no bugs are present on the map.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @return True if the game map is clear, false otherwise.
-	 */
-	bool IsMapClear(const hexTileMap& gameMap) const;
-
-
-	const TileData* const tileData = nullptr;
-
-
-	//bugType type;           /**< The type of bug represented by the tile. */
-	//Color bugColor = PINK;  /**< The color of the bug tile. */
-	//int playerId = INT_MAX; /**< The ID of the player owning the bug tile. */
-};
+constexpr std::array<playerPiece, DIFFERENT_PIECES_COUNT> STARTING_PIECES = { { { bugType::QUEEN_BEE, 1 },
+	                                                                                        { bugType::SPIDER, 2 },
+	                                                                                        { bugType::BEETLE, 2 },
+	                                                                                        { bugType::GRASS_HOPPER, 3 },
+	                                                                                        { bugType::SOLDIER_ANT, 3 } } };
 
+/**
+ * @brief Get the color of bug type.
+ *
+ * @param type The bug type.
+ * @return The color associated with the bug type.
+ */
+constexpr Color GetColorOfBugType(bugType type) {
+	switch (type) {
+		case bugType::QUEEN_BEE:
+			return QUEEN_BEE_COLOR;
+		case bugType::BEETLE:
+			return BEETLE_COLOR;
+		case bugType::SOLDIER_ANT:
+			return SOLDIER_ANT_COLOR;
+		case bugType::SPIDER:
+			return SPIDER_COLOR;
+		default:
+			return GRASS_HOPPER_COLOR;
+	}
+}
 
 /**
- * @brief Represents a Queen Bee bug tile in the game.
+ * @brief Get the id of the first piece with given index in player field.
  *
- * This class inherits from BaseBugTile and represents a Queen Bee bug tile in the game.
- * It provides specific behavior for Queen Bee tiles.
+ * @param handIndex Index of the piece in the player field.
+ * @return Offset of the first piece of this kind inside of the player's block of ids.
  */
-class QueenBee : public BaseBugTile {
-public:
-	/**
-	 * @brief Constructs a QueenBee object.
-	 *
-	 * Constructs a QueenBee object with the specified player ID, color, and type.
-	 *
-	 * @param playerId The ID of the player owning the Queen Bee tile.
-	 * @param color The color of the Queen Bee tile (optional, defaults to QUEEN_BEE_COLOR).
-	 * @param type The type of bug represented by the tile (optional, defaults to bugType::QUEEN_BEE).
-	 */
-	QueenBee(const TileData* const tileData);
-
-	/**
-	 * @brief Default destructor for QueenBee.
-	 *
-	 * Defines a default destructor for QueenBee objects.
-	 */
-	~QueenBee() = default;
-
-	/**
-	 * @brief Define rules for moving the Queen Bee tile.
-	 *
-	 * Implements the movement rules for Queen Bee tile.
-	 * Aditional rules for Queen bee are: Freedom to move, only 1 space per turn,
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param originalCords The original coordinates of the Queen Bee tile.
-	 * @return A set of HexCords representing the possible moves after the rules were applied.
-	 */
-
-	possibleMovesSet Move(const hexTileMap& gameMap, const possibleMovesSet& possibleGeneralMoves,
-	                      const HexCords& originalCords);
-};
-class Spider : public BaseBugTile {
-public:
-	/**
-	 * @brief Constructs a Spider object.
-	 *
-	 * Constructs a Spider object with the specified player ID, color, and type.
-	 *
-	 * @param playerId The ID of the player owning the Spider tile.
-	 * @param color The color of the Spider tile (optional, defaults to SPIDER_COLOR).
-	 * @param type The type of bug represented by the tile (optional, defaults to bugType::SPIDER).
-	 */
-	Spider(const TileData* const tileData);
-
-	/**
-	 * @brief Default destructor for Spider.
-	 *
-	 * Defines a default destructor for Spider objects.
-	 */
-	~Spider() = default;
-
-	/**
-	 * @brief Define rules for moving the Spider tile.
-	 *
-	 * Implements the movement rules for Spider tile.
-	 * Aditional rules for Spider are: Freedom to move, only 3 spaces per turn without backtracing.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param originalCords The original coordinates of the Spider tile.
-	 * @return A set of HexCords representing the possible moves after the rules were applied.
-	 */
-	possibleMovesSet Move(const hexTileMap& gameMap, const possibleMovesSet& possibleGeneralMoves,
-	                      const HexCords& originalCords);
-
-private:
-	/**
-	 * @brief Finds positions three tiles away from the origin tile.
-	 *
-	 * This function searches for positions on the game map that are three tiles away from the original tile and the
-	 * path must only contain tiles from possibleGeneralMoves.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param originalCords The coordinates of the original tile.
-	 * @return A set of HexCords representing positions three tiles away from the original tile.
-	 */
-	possibleMovesSet FindPositionThreeSpacesFromOrigin(const hexTileMap& gameMap,
-	                                                   const possibleMovesSet& possibleGeneralMoves,
-	                                                   const HexCords& originalCords);
-};
+constexpr int GetFirstOrdinalOfHandIndex(int handIndex) {
+	int result = 0;
+	for (int i = 0; i < handIndex; i++) {
+		result += STARTING_PIECES[i].second;
+	}
+	return result;
+}
 
-class Beetle : public BaseBugTile {
-public:
-	/**
-	 * @brief Constructs a Beetle object.
-	 *
-	 * Constructs a Beetle object with the specified player ID, color, and type.
-	 *
-	 * @param playerId The ID of the player owning the Beetle tile.
-	 * @param color The color of the Beetle tile (optional, defaults to BEETLE_COLOR).
-	 * @param type The type of bug represented by the tile (optional, defaults to bugType::BEETLE).
-	 */
-	Beetle(const TileData* const tileData);
-
-	/**
-	 * @brief Default destructor for Beetle.
-	 *
-	 * Defines a default destructor for Beetle objects.
-	 */
-	~Beetle() = default;
-
-	/**
-	 * @brief Define rules for moving the Beetle tile.
-	 *
-	 * Implements the movement rules for Beetle tile.
-	 * Aditional rules for Beetle are: Only 1 spaces per turn and can land on other occupied tiles.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param originalCords The original coordinates of the Beetle tile.
-	 * @return A set of HexCords representing the possible moves after the rules were applied.
-	 */
-	possibleMovesSet Move(const hexTileMap& gameMap, const possibleMovesSet& possibleGeneralMoves,
-	                      const HexCords& originalCords);
-
-	/**
-	 * @brief Sets the tile under the Beetle.
-	 *
-	 * Sets the tile under the Beetle to the specified tile.
-	 *
-	 * @param tile A shared pointer to the tile under the Beetle.
-	 */
-	void SetTileUnderBeetle(std::shared_ptr<BaseBugTile> tile) { bugTileUnderBeetle = tile; }
-
-	/**
-	 * @brief Gets the tile under the Beetle.
-	 *
-	 * Retrieves the tile under the Beetle.
-	 *
-	 * @return A shared pointer to the tile under the Beetle.
-	 */
-	std::shared_ptr<BaseBugTile> GetTileUnderBeetle() { return bugTileUnderBeetle; }
-
-private:
-	std::shared_ptr<BaseBugTile> bugTileUnderBeetle = nullptr; /**> Pointer to tile under beetle*/
-};
-class GrassHopper : public BaseBugTile {
-public:
-	/**
-	 * @brief Constructs a GrassHopper object.
-	 *
-	 * Constructs a GrassHopper object with the specified player ID, color, and type.
-	 *
-	 * @param playerId The ID of the player owning the Grass Hopper tile.
-	 * @param color The color of the Grass Hopper tile (optional, defaults to GRASS_HOPPER_COLOR).
-	 * @param type The type of bug represented by the tile (optional, defaults to bugType::GRASS_HOPPER).
-	 */
-	GrassHopper(const TileData* const tileData);
-
-	/**
-	 * @brief Default destructor for Grass Hopper.
-	 *
-	 * Defines a default destructor for GrassHopper objects.
-	 */
-	~GrassHopper() = default;
-
-	/**
-	 * @brief Define rules for moving the Grass Hopper tile.
-	 *
-	 * Implements the movement rules for Grass Hopper tile.
-	 * Aditional rules for Grass Hopper are: Any number of spaces per turn, but must jump in straight line over occupied
-	 * tiles
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param originalCords The original coordinates of the Grass Hopper tile.
-	 * @return A set of HexCords representing the possible moves after the rules were applied.
-	 */
-	possibleMovesSet Move(const hexTileMap& gameMap, const possibleMovesSet& possibleGeneralMoves,
-	                      const HexCords& originalCords);
-};
-class SoldierAnt : public BaseBugTile {
-public:
-	/**
-	 * @brief Constructs a SoldierAnt object.
-	 *
-	 * Constructs a SoldierAnt object with the specified player ID, color, and type.
-	 *
-	 * @param playerId The ID of the player owning the Soldier Ant tile.
-	 * @param color The color of the Soldier Ant tile (optional, defaults to SOLDIER_ANT_COLOR).
-	 * @param type The type of bug represented by the tile (optional, defaults to bugType::SOLDIER_ANT).
-	 */
-	SoldierAnt(const TileData* const tileData);
-
-	/**
-	 * @brief Default destructor for Soldier Ant.
-	 *
-	 * Defines a default destructor for SoldierAnt objects.
-	 */
-	~SoldierAnt() = default;
-
-	/**
-	 * @brief Define rules for moving the Soldier Ant tile.
-	 *
-	 * Implements the movement rules for Soldier Ant tile.
-	 * Aditional rules for Soldier Ant are: Freedom to move and can move any number of tiles around hive.
-	 *
-	 * @param gameMap The game map represented as a hexTileMap.
-	 * @param possibleGeneralMoves The set of possible general moves.
-	 * @param originalCords The original coordinates of the Soldier Ant tile.
-	 * @return A set of HexCords representing the possible moves after the rules were applied.
-	 */
-	possibleMovesSet Move(const hexTileMap& gameMap, const possibleMovesSet& possibleGeneralMoves,
-	                      const HexCords& originalCords);
-};
+/**
+ * @brief Creates id of the piece.
+ *
+ * Ids of the first player are 0-10, ids of the second player 11-21. Inside of the player's block pieces are ordered
+ * as in STARTING_PIECES.
+ *
+ * @param playerId The ID of the player owning the piece.
+ * @param handIndex Index of the piece in the player field.
+ * @param ordinal Which of the pieces of the same kind it is (0 for the first placed).
+ * @return Id of the piece.
+ */
+constexpr pieceId MakePieceId(int playerId, int handIndex, int ordinal) {
+	return (pieceId)(playerId * PIECES_PER_PLAYER + GetFirstOrdinalOfHandIndex(handIndex) + ordinal);
+}
+
+/**
+ * @brief Get the index of the piece in the player field.
+ *
+ * @param id Id of the piece, must not be NO_PIECE.
+ * @return Index into STARTING_PIECES.
+ */
+constexpr int GetHandIndexOfPiece(int id) {
+	int handIndex = 0;
+	while (handIndex + 1 < DIFFERENT_PIECES_COUNT && GetFirstOrdinalOfHandIndex(handIndex + 1) <= id % PIECES_PER_PLAYER) {
+		handIndex++;
+	}
+	return handIndex;
+}
+
+/**
+ * @brief Creates static data of the piece with given id.
+ *
+ * @param id Id of the piece.
+ * @return Data of the piece.
+ */
+constexpr TileData MakeTileData(int id) {
+	auto type = STARTING_PIECES[GetHandIndexOfPiece(id)].first;
+	return TileData(type, GetColorOfBugType(type), id / PIECES_PER_PLAYER);
+}
+
+/**
+ * @brief Generates the table of static data for all pieces.
+ */
+template <std::size_t... ids>
+constexpr std::array<TileData, sizeof...(ids)> GeneratePiecesTileData(std::index_sequence<ids...>) {
+	return { { MakeTileData((int)ids)... } };
+}
+
+/**
+ * @brief Static data of all pieces indexed by their id.
+ */
+constexpr std::array<TileData, PIECES_COUNT> PIECES_TILE_DATA =
+    GeneratePiecesTileData(std::make_index_sequence<PIECES_COUNT>());
+
+/**
+ * @brief Get the static data of the piece.
+ *
+ * @param id Id of the piece, must not be NO_PIECE.
+ * @return const TileData&
+ */
+constexpr const TileData& GetTileData(pieceId id) { return PIECES_TILE_DATA[id]; }
+
+/**
+ * @brief Get the Player ID of the piece.
+ *
+ * @param id Id of the piece, must not be NO_PIECE.
+ * @return The ID of the player owning the piece.
+ */
+constexpr int GetPlayerIdOfPiece(pieceId id) { return PIECES_TILE_DATA[id].playerId; }
+
+/**
+ * @brief Get the Bug Type of the piece.
+ *
+ * @param id Id of the piece, must not be NO_PIECE.
+ * @return The type of bug represented by the piece.
+ */
+constexpr bugType GetBugTypeOfPiece(pieceId id) { return PIECES_TILE_DATA[id].type; }
+
+// Rules of the bug pieces
+//
+// All rule functions are templated on the board representation (see HexBoard) and are visible in the header, so
+// compiler can inline them into the caller. Possible moves are reported through the emit callable, that is called
+// with HexCords of every possible destination. Searches keep their spaces in FixedCordsSet, so they never allocate.
+
+/**
+ * @brief Upper bound of the number of spaces on the border of the hive, every piece has at most 6 empty neighbors.
+ */
+constexpr std::size_t MAX_BORDER_SPACES = SIZE_OF_AXIAL_VECTORS * PIECES_COUNT;
+
+/**
+ * @brief Checks the integrity of the hive without one tile.
+ *
+ * This function checks the integrity of the hive without considering one specific tile.
+ *
+ * @param gameMap The game map.
+ * @param cordsOfRemovedHex The coordinates of the removed hex tile.
+ * @return True if the hive remains intact after removing the specified tile, false otherwise.
+ */
+template <HexBoard Board>
+bool CheckIntegrityOfHiveWithoutOneTile(const Board& gameMap, const HexCords& cordsOfRemovedHex) {
+	int occupiedTilesCount = GetOccupiedTilesCount(gameMap);
+
+	auto neighbors = GetOccupiedNeighborsMask(gameMap, cordsOfRemovedHex);
+	if (neighbors == 0) {
+		return occupiedTilesCount <= 1;
+	}
+
+	// Only occupied spaces are visited, the removed one included, and spaces after the processed one form the queue
+	FixedCordsSet<PIECES_COUNT> visited;
+	visited.Insert(cordsOfRemovedHex);
+	visited.Insert(cordsOfRemovedHex + AXIAL_DIRECTION_VECTORS[std::countr_zero(neighbors)]);
+	for (std::size_t processed = 1; processed < visited.Size(); processed++) {
+		auto someElement = visited[processed];
+		ForEachNeighborInMask(someElement, GetOccupiedNeighborsMask(gameMap, someElement),
+		                      [&](const HexCords& neighbor) { visited.Insert(neighbor); });
+	}
+
+	return (int)visited.Size() == occupiedTilesCount;
+}
+
+/**
+ * @brief Checks if a tile is surrounded by tiles.
+ *
+ * This function checks if a space on the game map is surrounded by atleast 5 tiles.
+ *
+ * @param gameMap The game map.
+ * @param cordsOfHex The coordinates of the space.
+ * @return True if the space is surrounded by tiles, false otherwise.
+ */
+template <HexBoard Board>
+bool IsSpaceSurrounded(const Board& gameMap, const HexCords& cordsOfHex) {
+	return GetOccupiedNeighborsCount(gameMap, cordsOfHex) > 4;
+}
+
+/**
+ * @brief Checks if the bug tile has freedom to move.
+ *
+ * This function checks if the bug tile isn't surrounded.
+ *
+ * @param gameMap The game map.
+ * @param cordsOfRemovedHex The coordinates of the bug tile.
+ * @return True if the bug tile has freedom to move, false otherwise.
+ */
+template <HexBoard Board>
+bool FreedomToMove(const Board& gameMap, const HexCords& cordsOfRemovedHex) {
+	return !IsSpaceSurrounded(gameMap, cordsOfRemovedHex);
+}
+
+/**
+ * @brief Checks if the space would be on the border of the hive after removing one tile.
+ *
+ * Space is on the border of the hive if it is empty and has atleast one occupied neighbor. The removed tile does not
+ * count as a neighbor.
+ *
+ * @param gameMap The game map.
+ * @param cordsOfHex The coordinates of the space.
+ * @param cordsOfRemovedHex The coordinates of the removed hex tile.
+ * @return True if the space would be on the border of the hive, false otherwise.
+ */
+template <HexBoard Board>
+bool IsOnBorderOfHiveWithoutTile(const Board& gameMap, const HexCords& cordsOfHex, const HexCords& cordsOfRemovedHex) {
+	if (!IsOnMap(gameMap, cordsOfHex) || GetPieceAt(gameMap, cordsOfHex) != NO_PIECE) {
+		return false;
+	}
+	bool result = false;
+	ForEachNeighborInMask(cordsOfHex, GetOccupiedNeighborsMask(gameMap, cordsOfHex),
+	                      [&](const HexCords& neighbor) { result |= neighbor != cordsOfRemovedHex; });
+	return result;
+}
+
+/**
+ * @brief Define rules for moving the Queen Bee tile.
+ *
+ * Base rules for all tiles is: The removal must not violate the integrity of the hive.
+ * Aditional rules for Queen bee are: Freedom to move, only 1 space per turn.
+ *
+ * @param gameMap The game map.
+ * @param originalCords The original coordinates of the Queen Bee tile.
+ * @param emit Callable receiving the possible moves, it can stop the generation by returning true.
+ * @return True if emit stopped the generation, false otherwise.
+ */
+template <HexBoard Board, typename Emit>
+bool GenerateQueenBeeMoves(const Board& gameMap, const HexCords& originalCords, Emit&& emit) {
+	if (!CheckIntegrityOfHiveWithoutOneTile(gameMap, originalCords) || !FreedomToMove(gameMap, originalCords)) {
+		return false;
+	}
+
+	auto emptyNeighbors = GetEmptyNeighborsMask(gameMap, originalCords);
+	return ForEachNeighborInMask(originalCords, emptyNeighbors, [&](const HexCords& neighbor) {
+		return IsOnBorderOfHiveWithoutTile(gameMap, neighbor, originalCords) && CallAndCheckStop(emit, neighbor);
+	});
+}
+
+/**
+ * @brief Define rules for moving the Spider tile.
+ *
+ * Aditional rules for Spider are: Freedom to move, only 3 spaces per turn without backtracing.
+ * Path must only contain spaces on the border of the hive.
+ *
+ * @param gameMap The game map.
+ * @param originalCords The original coordinates of the Spider tile.
+ * @param emit Callable receiving the possible moves, it can stop the generation by returning true.
+ * @return True if emit stopped the generation, false otherwise.
+ */
+template <HexBoard Board, typename Emit>
+bool GenerateSpiderMoves(const Board& gameMap, const HexCords& originalCords, Emit&& emit) {
+	if (!CheckIntegrityOfHiveWithoutOneTile(gameMap, originalCords) || !FreedomToMove(gameMap, originalCords)) {
+		return false;
+	}
+
+	// Visited spaces in the order of the breadth-first search, with the number of steps to reach them
+	FixedCordsSet<MAX_BORDER_SPACES + 1> visited;
+	std::array<std::uint8_t, MAX_BORDER_SPACES + 1> steps;
+	visited.Insert(originalCords);
+	steps[0] = 0;
+
+	for (std::size_t processed = 0; processed < visited.Size(); processed++) {
+		auto itemToProcess = visited[processed];
+		int stepsOfItem = steps[processed];
+		if (stepsOfItem == 3) {
+			continue;
+		}
+
+		auto emptyNeighbors = GetEmptyNeighborsMask(gameMap, itemToProcess);
+		bool stopped = ForEachNeighborInMask(itemToProcess, emptyNeighbors, [&](const HexCords& neighbor) {
+			if (!visited.Contains(neighbor) && IsOnBorderOfHiveWithoutTile(gameMap, neighbor, originalCords)) {
+				steps[visited.Size()] = (std::uint8_t)(stepsOfItem + 1);
+				visited.Insert(neighbor);
+				if (stepsOfItem == 2) {
+					return CallAndCheckStop(emit, neighbor);
+				}
+			}
+			return false;
+		});
+		if (stopped) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Define rules for moving the Beetle tile.
+ *
+ * Aditional rules for Beetle are: Only 1 spaces per turn and can land on other occupied tiles.
+ *
+ * @param gameMap The game map.
+ * @param originalCords The original coordinates of the Beetle tile.
+ * @param isOnTopOfHive Flag indicating if the Beetle lies on top of other tile.
+ * @param emit Callable receiving the possible moves, it can stop the generation by returning true.
+ * @return True if emit stopped the generation, false otherwise.
+ */
+template <HexBoard Board, typename Emit>
+bool GenerateBeetleMoves(const Board& gameMap, const HexCords& originalCords, const bool isOnTopOfHive, Emit&& emit) {
+	if (!isOnTopOfHive && !CheckIntegrityOfHiveWithoutOneTile(gameMap, originalCords)) {
+		return false;
+	}
+
+	for (const auto& neighbor : GetNeighborsOfTile(originalCords)) {
+		if (!IsOnMap(gameMap, neighbor)) {
+			continue;
+		}
+		if (isOnTopOfHive || GetPieceAt(gameMap, neighbor) != NO_PIECE ||
+		    IsOnBorderOfHiveWithoutTile(gameMap, neighbor, originalCords)) {
+			if (CallAndCheckStop(emit, neighbor)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Define rules for moving the Grass Hopper tile.
+ *
+ * Aditional rules for Grass Hopper are: Any number of spaces per turn, but must jump in straight line over occupied
+ * tiles
+ *
+ * @param gameMap The game map.
+ * @param originalCords The original coordinates of the Grass Hopper tile.
+ * @param emit Callable receiving the possible moves, it can stop the generation by returning true.
+ * @return True if emit stopped the generation, false otherwise.
+ */
+template <HexBoard Board, typename Emit>
+bool GenerateGrassHopperMoves(const Board& gameMap, const HexCords& originalCords, Emit&& emit) {
+	if (!CheckIntegrityOfHiveWithoutOneTile(gameMap, originalCords)) {
+		return false;
+	}
+
+	for (const auto& vector : AXIAL_DIRECTION_VECTORS) {
+		auto tempPosition = originalCords + vector;
+		bool moved = false;
+		while (GetPieceAt(gameMap, tempPosition) != NO_PIECE) {
+			tempPosition += vector;
+			moved = true;
+		}
+
+		if (moved && IsOnMap(gameMap, tempPosition) && CallAndCheckStop(emit, tempPosition)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Define rules for moving the Soldier Ant tile.
+ *
+ * Aditional rules for Soldier Ant are: Freedom to move and can move any number of tiles around hive. It can't enter
+ * spaces surrounded by tiles.
+ *
+ * @param gameMap The game map.
+ * @param originalCords The original coordinates of the Soldier Ant tile.
+ * @param emit Callable receiving the possible moves, it can stop the generation by returning true.
+ * @return True if emit stopped the generation, false otherwise.
+ */
+template <HexBoard Board, typename Emit>
+bool GenerateSoldierAntMoves(const Board& gameMap, const HexCords& originalCords, Emit&& emit) {
+	if (!CheckIntegrityOfHiveWithoutOneTile(gameMap, originalCords) || !FreedomToMove(gameMap, originalCords)) {
+		return false;
+	}
+
+	FixedCordsSet<MAX_BORDER_SPACES + 1> visited;
+	visited.Insert(originalCords);
+	for (std::size_t processed = 0; processed < visited.Size(); processed++) {
+		auto someElement = visited[processed];
+		auto emptyNeighbors = GetEmptyNeighborsMask(gameMap, someElement);
+		bool stopped = ForEachNeighborInMask(someElement, emptyNeighbors, [&](const HexCords& neighbor) {
+			if (!visited.Contains(neighbor) && IsOnBorderOfHiveWithoutTile(gameMap, neighbor, originalCords) &&
+			    !IsSpaceSurrounded(gameMap, neighbor)) {
+				visited.Insert(neighbor);
+				return CallAndCheckStop(emit, neighbor);
+			}
+			return false;
+		});
+		if (stopped) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Reports possible moves of the piece lying on the game map.
+ *
+ * Dispatches to the rules of the bug type of the piece.
+ *
+ * @param gameMap The game map.
+ * @param piece The id of the moved piece.
+ * @param originalCords The original coordinates of the piece.
+ * @param isOnTopOfHive Flag indicating if the piece lies on top of other tile.
+ * @param emit Callable receiving the possible moves, it can stop the generation by returning true.
+ * @return True if emit stopped the generation, false otherwise.
+ */
+template <HexBoard Board, typename Emit>
+bool GenerateMoves(const Board& gameMap, const pieceId piece, const HexCords& originalCords,
+                   const bool isOnTopOfHive, Emit&& emit) {
+	TRACE_SCOPE("GenerateMoves");
+	switch (GetBugTypeOfPiece(piece)) {
+		case bugType::QUEEN_BEE:
+			return GenerateQueenBeeMoves(gameMap, originalCords, emit);
+		case bugType::BEETLE:
+			return GenerateBeetleMoves(gameMap, originalCords, isOnTopOfHive, emit);
+		case bugType::SOLDIER_ANT:
+			return GenerateSoldierAntMoves(gameMap, originalCords, emit);
+		case bugType::SPIDER:
+			return GenerateSpiderMoves(gameMap, originalCords, emit);
+		case bugType::GRASS_HOPPER:
+			return GenerateGrassHopperMoves(gameMap, originalCords, emit);
+	}
+	return false;
+}
 
 #endif  // !BUG_TILES_H
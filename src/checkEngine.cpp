@@ -0,0 +1,162 @@
+#include "checkEngine.h"
+#include "common.h"
+#include "hexUtilities.h"
+#include "HiveBoard.h"
+#include "MovePicker.h"
+#include "Search.h"
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+static int failuresCount = 0; /**< Number of failed checks so far. */
+
+bool Check(bool condition, const std::string& message) {
+	if (!condition) {
+		failuresCount++;
+		std::cout << "    FAIL: " << message << std::endl;
+	}
+	return condition;
+}
+
+/**
+ * @brief Get the key ordering moves, so lists of moves can be compared as sets.
+ *
+ * @param move The move.
+ * @return Tuple of all fields of the move.
+ */
+static auto GetMoveKey(const Move& move) {
+	return std::make_tuple(move.piece, move.isPlacement, move.from.q, move.from.r, move.to.q, move.to.r);
+}
+
+void SortMoves(std::vector<Move>& moves) {
+	std::sort(moves.begin(), moves.end(),
+	          [](const Move& first, const Move& second) { return GetMoveKey(first) < GetMoveKey(second); });
+}
+
+std::vector<Move> GenerateReferenceMoves(const HiveBoard& gameMap, int IDOfPlayer) {
+	std::vector<Move> moves;
+	if (gameMap.HasPieceInHand(IDOfPlayer)) {
+		ForEachPlaceablePiece(gameMap, IDOfPlayer, [&](pieceId piece) {
+			if (gameMap.GetOccupiedTilesCount() == 0) {
+				moves.push_back({ piece, true, { 0, 0 }, { 0, 0 } });
+			}
+			GeneratePlacements(gameMap, IDOfPlayer,
+			                   [&](const HexCords& cords) { moves.push_back({ piece, true, { 0, 0 }, cords }); });
+		});
+	}
+	if (!gameMap.IsPieceOnBoard(MakePieceId(IDOfPlayer, 0, 0))) {
+		return moves;
+	}
+	for (int i = 0; i < PIECES_PER_PLAYER; i++) {
+		auto piece = (pieceId)(IDOfPlayer * PIECES_PER_PLAYER + i);
+		if (!gameMap.IsPieceOnBoard(piece) || gameMap.GetPieceAt(gameMap.GetPositionOfPiece(piece)) != piece) {
+			continue;
+		}
+		const auto cords = gameMap.GetPositionOfPiece(piece);
+		GenerateMoves(gameMap, piece, cords, gameMap.GetPieceUnder(piece) != NO_PIECE,
+		              [&](const HexCords& to) { moves.push_back({ piece, false, cords, to }); });
+	}
+	return moves;
+}
+
+void CheckMovePicker() {
+	std::cout << "MovePicker returns the moves of the generators exactly once" << std::endl;
+	std::mt19937 random(RANDOM_SEED);
+	MoveHistory history;
+	killerMoves killers = {};
+	MovePicker::Buffers pickerBuffers;
+	int positionsCount = 0;
+
+	PlayRandomGames(
+	    random,
+	    [&](const HiveBoard& gameMap, int IDOfPlayer, std::vector<Move> expected) {
+		    positionsCount++;
+		    // Hash move is legal most of the time, killers usually come from the previous position
+		    Move hashMove = !expected.empty() && random() % 4 != 0 ? expected[random() % expected.size()] : killers[0];
+		    if (!expected.empty()) {
+			    killers[random() % 2] = expected[random() % expected.size()];
+			    history.Add(expected[random() % expected.size()], (int)(random() % 512) - 256);
+		    }
+
+		    MovePicker picker(gameMap, IDOfPlayer, hashMove, killers, history, pickerBuffers);
+		    std::vector<Move> picked;
+		    Move move;
+		    while (picker.Next(move)) {
+			    picked.push_back(move);
+		    }
+
+		    SortMoves(picked);
+		    SortMoves(expected);
+		    bool hasDuplicate = std::adjacent_find(picked.begin(), picked.end()) != picked.end();
+		    Check(!hasDuplicate, "picker returned some move twice in position " + std::to_string(positionsCount));
+		    picked.erase(std::unique(picked.begin(), picked.end()), picked.end());
+		    Check(picked == expected, "picker returned " + std::to_string(picked.size()) + " moves instead of " +
+		                                  std::to_string(expected.size()) + " in position " +
+		                                  std::to_string(positionsCount));
+	    },
+	    [](const HiveBoard&, const Move&) {});
+	std::cout << "    " << positionsCount << " positions" << std::endl;
+}
+
+void CheckSurroundInOne() {
+	// Five neighbors of the first player's Queen are occupied and Ant of the second player lies next to the sixth one
+	std::cout << "Search finds the surround in one move" << std::endl;
+	const HexCords queenCords = { 0, 0 };
+	const auto queenNeighbors = GetNeighborsOfTile(queenCords);
+	const HexCords emptyNeighbor = queenNeighbors[0];
+
+	HiveBoard gameMap;
+	gameMap.PlacePiece(MakePieceId(0, 0, 0), queenCords);
+	std::vector<pieceId> fillers = { MakePieceId(1, 0, 0), MakePieceId(0, 1, 0), MakePieceId(0, 4, 0),
+		                             MakePieceId(0, 4, 1), MakePieceId(0, 4, 2) };
+	for (int i = 1; i < SIZE_OF_AXIAL_VECTORS; i++) {
+		gameMap.PlacePiece(fillers[i - 1], queenNeighbors[i]);
+	}
+	// Ant touches the empty neighbor and one filler, so it can slide into the empty neighbor
+	for (const auto& cords : GetNeighborsOfTile(emptyNeighbor)) {
+		if (gameMap.GetPieceAt(cords) == NO_PIECE && gameMap.GetOccupiedNeighborsCount(cords) == 1) {
+			gameMap.PlacePiece(MakePieceId(1, 4, 0), cords);
+			break;
+		}
+	}
+
+	for (int depth = 1; depth <= 3; depth++) {
+		Search search(16, nullptr, nullptr);
+		auto move = search.FindBestMove(gameMap, 1, depth);
+		if (!Check(move.piece != NO_PIECE, "no move found at depth " + std::to_string(depth))) {
+			continue;
+		}
+		HiveBoard afterMove = gameMap;
+		afterMove.MakeMove(move);
+		Check(afterMove.IsQueenSurrounded(0) && !afterMove.IsQueenSurrounded(1),
+		      "move found at depth " + std::to_string(depth) + " doesn't surround the Queen");
+		Check(search.GetLastScore() == Search::WIN_SCORE - 1,
+		      "score " + std::to_string(search.GetLastScore()) + " at depth " + std::to_string(depth) +
+		          " isn't the surround in one");
+	}
+}
+
+//------------------------------------------------------------------------------------
+// Engine checks entry point
+//------------------------------------------------------------------------------------
+int main() {
+	try {
+		CheckMovePicker();
+		CheckSurroundInOne();
+		CheckNnueUpdate();
+		CheckNnueKernels();
+		CheckSurroundSolver();
+		CheckTablebase();
+	} catch (const std::exception& e) {
+		std::cout << e.what() << std::endl;
+		return 1;
+	}
+	std::cout << (failuresCount == 0 ? "All checks passed" : std::to_string(failuresCount) + " checks failed")
+	          << std::endl;
+	return failuresCount == 0 ? 0 : 1;
+}
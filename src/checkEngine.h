@@ -0,0 +1,124 @@
+/**
+ * @file checkEngine.h
+ * @author Vojtech Venzara (Vojtaven@seznam.cz)
+ * @brief Contains helpers shared by the checks of the engine and the checks themselves
+ * @version 0.1
+ * @date 2024-04-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef CHECK_ENGINE_H
+#define CHECK_ENGINE_H
+
+#include "bugTiles.h"
+#include "HiveBoard.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+// Every check plays or builds positions from a fixed seed, so failures are reproducible
+constexpr unsigned RANDOM_SEED = 2024;  /**< Seed of all random positions. */
+constexpr int RANDOM_GAMES_COUNT = 200; /**< Number of random games of every check. */
+constexpr int RANDOM_GAME_PLIES = 80;   /**< Maximal length of random game. */
+
+/**
+ * @brief Reports the failed check, if the condition doesn't hold.
+ *
+ * @param condition The checked condition.
+ * @param message Description of the failure.
+ * @return The condition.
+ */
+bool Check(bool condition, const std::string& message);
+
+/**
+ * @brief Sorts the moves by all their fields, so lists of moves can be compared as sets.
+ *
+ * @param moves The moves.
+ */
+void SortMoves(std::vector<Move>& moves);
+
+/**
+ * @brief Generates all moves of the player directly by GeneratePlacements and GenerateMoves.
+ *
+ * @param gameMap The game board.
+ * @param IDOfPlayer The ID of the player on turn.
+ * @return The moves, pass isn't included.
+ */
+std::vector<Move> GenerateReferenceMoves(const HiveBoard& gameMap, int IDOfPlayer);
+
+/**
+ * @brief Checks if the game has ended by surrounding some Queen.
+ *
+ * @param gameMap The game board.
+ * @return True if some Queen is surrounded.
+ */
+inline bool IsGameOver(const HiveBoard& gameMap) {
+	return gameMap.IsQueenSurrounded(0) || gameMap.IsQueenSurrounded(1);
+}
+
+/**
+ * @brief Plays random games and calls the function before every move.
+ *
+ * Player without any move passes, game ends when some Queen is surrounded, nobody can move or after RANDOM_GAME_PLIES.
+ *
+ * @param random The random generator.
+ * @param function Callable taking the board, the ID of the player on turn and the moves of the player.
+ * @param afterMove Callable taking the board after the move and the played move, pass has piece NO_PIECE.
+ */
+template <typename Function, typename AfterMove>
+void PlayRandomGames(std::mt19937& random, Function&& function, AfterMove&& afterMove) {
+	for (int game = 0; game < RANDOM_GAMES_COUNT; game++) {
+		HiveBoard gameMap;
+		int IDOfPlayer = (int)(random() % 2);
+		int passesInRow = 0;
+		for (int ply = 0; ply < RANDOM_GAME_PLIES && !IsGameOver(gameMap) && passesInRow < 2; ply++) {
+			auto moves = GenerateReferenceMoves(gameMap, IDOfPlayer);
+			function(gameMap, IDOfPlayer, moves);
+			Move move;
+			if (!moves.empty()) {
+				move = moves[random() % moves.size()];
+				gameMap.MakeMove(move);
+			}
+			passesInRow = moves.empty() ? passesInRow + 1 : 0;
+			afterMove(gameMap, move);
+			IDOfPlayer = (IDOfPlayer + 1) % 2;
+		}
+	}
+}
+
+/**
+ * @brief Checks that MovePicker returns every move of the generators exactly once, whatever hash and killer moves it
+ * gets.
+ */
+void CheckMovePicker();
+
+/**
+ * @brief Checks that Search finds the surround of the Queen, that is one move away.
+ */
+void CheckSurroundInOne();
+
+/**
+ * @brief Checks that the accumulator updated by moves and passes of random games equals the refreshed one.
+ */
+void CheckNnueUpdate();
+
+/**
+ * @brief Checks that the vectorized kernels of the network give the same results as the scalar ones and that the
+ * output doesn't overflow.
+ */
+void CheckNnueKernels();
+
+/**
+ * @brief Checks that SurroundSolver proves exactly the positions the brute force wins and that its best move wins.
+ */
+void CheckSurroundSolver();
+
+/**
+ * @brief Checks the generated tablebase against SurroundSolver, against the results of children of its positions and
+ * on positions with surrounded Queen.
+ */
+void CheckTablebase();
+
+#endif  // !CHECK_ENGINE_H
@@ -0,0 +1,149 @@
+#include "checkEngine.h"
+#include "common.h"
+#include "HiveBoard.h"
+#include "Nnue.h"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Writes the network file and loads it.
+ *
+ * @param network The loaded network.
+ * @param firstLayerWeight Generator of the biases and weights of the first layer.
+ * @param outputWeight Generator of the weights of the output.
+ * @param outputBias The bias of the output.
+ */
+static void LoadNetwork(NnueNetwork& network, const std::function<std::int16_t()>& firstLayerWeight,
+                        const std::function<std::int16_t()>& outputWeight, std::int32_t outputBias) {
+	auto path = (std::filesystem::temp_directory_path() / "hive_check.nnue").string();
+	{
+		std::ofstream file(path, std::ios::binary);
+		auto writeValue = [&file](auto value) { file.write((const char*)&value, sizeof(value)); };
+		writeValue(NnueNetwork::FILE_MAGIC);
+		writeValue(NnueNetwork::FILE_VERSION);
+		writeValue((std::uint32_t)NnueNetwork::HIDDEN_SIZE);
+		writeValue((std::uint32_t)NnueNetwork::FEATURES_COUNT);
+		for (size_t i = 0; i < (size_t)(NnueNetwork::FEATURES_COUNT + 1) * NnueNetwork::HIDDEN_SIZE; i++) {
+			writeValue(firstLayerWeight());
+		}
+		for (int i = 0; i < 2 * NnueNetwork::HIDDEN_SIZE; i++) {
+			writeValue(outputWeight());
+		}
+		writeValue(outputBias);
+		if (!file) {
+			throw std::runtime_error("Can't write network weights file " + path);
+		}
+	}
+	network.LoadFromFile(path);
+	std::filesystem::remove(path);
+}
+
+/**
+ * @brief Loads the network with small random weights, so no sum of the first layer overflows.
+ *
+ * @param network The loaded network.
+ * @param random The random generator.
+ */
+static void LoadRandomNetwork(NnueNetwork& network, std::mt19937& random) {
+	auto weight = [&random]() { return (std::int16_t)((int)(random() % 201) - 100); };
+	LoadNetwork(network, weight, weight, (std::int32_t)((int)(random() % 2001) - 1000));
+}
+
+void CheckNnueUpdate() {
+	std::cout << "NnueNetwork::Update matches NnueNetwork::Refresh" << std::endl;
+	std::mt19937 random(RANDOM_SEED);
+	NnueNetwork network;
+	LoadRandomNetwork(network, random);
+
+	nnueAccumulator accumulator;
+	nnueAccumulator refreshed;
+	int movesCount = 0;
+	PlayRandomGames(
+	    random,
+	    [&](const HiveBoard& gameMap, int, const std::vector<Move>&) {
+		    if (gameMap.GetOccupiedTilesCount() == 0) {
+			    network.Refresh(gameMap, accumulator);
+		    }
+	    },
+	    [&](const HiveBoard& gameMap, const Move& move) {
+		    movesCount++;
+		    nnueAccumulator updated;
+		    network.Update(gameMap, move, accumulator, updated);
+		    network.Refresh(gameMap, refreshed);
+		    accumulator = updated;
+		    Check(updated.values == refreshed.values && updated.anchors == refreshed.anchors,
+		          "updated accumulator differs after move " + std::to_string(movesCount));
+		    for (int player = 0; player < 2; player++) {
+			    Check(network.Evaluate(updated, player) == network.Evaluate(refreshed, player),
+			          "evaluation differs after move " + std::to_string(movesCount));
+		    }
+		    // Continue from the refreshed accumulator, so one failure isn't reported for the rest of the game
+		    accumulator = refreshed;
+	    });
+	std::cout << "    " << movesCount << " moves" << std::endl;
+}
+
+void CheckNnueKernels() {
+	std::cout << "Kernels of NnueNetwork match the scalar kernels" << std::endl;
+	std::cout << "    compiled kernels: " << NnueNetwork::KERNELS_NAME << std::endl;
+	std::mt19937 random(RANDOM_SEED);
+	NnueNetwork network;
+	LoadRandomNetwork(network, random);
+
+	// Weights of the whole 16-bit range, so wrapping of the first layer and clipping of the output are covered
+	alignas(32) std::array<std::int16_t, NnueNetwork::HIDDEN_SIZE> removed;
+	alignas(32) std::array<std::int16_t, NnueNetwork::HIDDEN_SIZE> added;
+	alignas(32) std::array<std::int16_t, NnueNetwork::HIDDEN_SIZE> weights;
+	alignas(32) std::array<std::int16_t, NnueNetwork::HIDDEN_SIZE> output;
+	alignas(32) std::array<std::int16_t, NnueNetwork::HIDDEN_SIZE> scalarOutput;
+	auto fillRandom = [&random](auto& values) {
+		for (auto& value : values) {
+			value = (std::int16_t)random();
+		}
+	};
+
+	nnueAccumulator accumulator;
+	int viewsCount = 0;
+	PlayRandomGames(
+	    random, [](const HiveBoard&, int, const std::vector<Move>&) {},
+	    [&](const HiveBoard& gameMap, const Move&) {
+		    network.Refresh(gameMap, accumulator);
+		    for (const auto& values : accumulator.values) {
+			    viewsCount++;
+			    fillRandom(removed);
+			    fillRandom(added);
+			    fillRandom(weights);
+			    Check(NnueNetwork::DotClippedView(values.data(), weights.data()) ==
+			              NnueNetwork::DotClippedViewScalar(values.data(), weights.data()),
+			          "dot product differs in view " + std::to_string(viewsCount));
+			    for (int variant = 0; variant < 4; variant++) {
+				    const auto* removedWeights = variant & 1 ? removed.data() : nullptr;
+				    const auto* addedWeights = variant & 2 ? added.data() : nullptr;
+				    NnueNetwork::ApplyFeatures(values.data(), removedWeights, addedWeights, output.data());
+				    NnueNetwork::ApplyFeaturesScalar(values.data(), removedWeights, addedWeights, scalarOutput.data());
+				    Check(output == scalarOutput, "applied features differ in view " + std::to_string(viewsCount));
+			    }
+		    }
+	    });
+	std::cout << "    " << viewsCount << " views" << std::endl;
+
+	// Largest activations, weights and bias overflow 32 bits when summed
+	constexpr std::int16_t maxWeight = std::numeric_limits<std::int16_t>::max();
+	constexpr std::int32_t maxBias = std::numeric_limits<std::int32_t>::max();
+	LoadNetwork(
+	    network, []() { return (std::int16_t)NnueNetwork::ACTIVATION_LIMIT; }, []() { return maxWeight; }, maxBias);
+	network.Refresh(HiveBoard(), accumulator);
+	std::int64_t expected = maxBias + 2LL * NnueNetwork::HIDDEN_SIZE * NnueNetwork::ACTIVATION_LIMIT * maxWeight;
+	Check(network.Evaluate(accumulator, 0) == expected / NnueNetwork::OUTPUT_SCALE,
+	      "evaluation with the largest weights overflows");
+}
@@ -0,0 +1,110 @@
+#include "checkEngine.h"
+#include "common.h"
+#include "HiveBoard.h"
+#include "SurroundSolver.h"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static constexpr int BRUTE_FORCE_MAX_PLIES = 3;    /**< Deepest solve compared with the brute force. */
+static constexpr int CROWDED_QUEEN_NEIGHBORS = 4;  /**< Neighbors of the defending Queen of the compared positions. */
+static constexpr int SOLVER_POSITIONS_COUNT = 600; /**< Number of compared positions. */
+
+/**
+ * @brief Decides by plain minimax, if the attacker surrounds the defender's Queen within the plies.
+ *
+ * Follows the rules of SurroundSolver: attacker's surrounded Queen, game where nobody can move and running out of
+ * plies are losses of the attacker, player without any move passes.
+ *
+ * @param gameMap The game board, it is restored before returning.
+ * @param attackerId The ID of the attacker.
+ * @param IDOfPlayer The ID of the player on turn.
+ * @param plies The remaining plies.
+ * @return True if the attacker wins, false otherwise.
+ */
+static bool CanSurround(HiveBoard& gameMap, int attackerId, int IDOfPlayer, int plies) {
+	if (gameMap.IsQueenSurrounded(attackerId)) {
+		return false;
+	}
+	if (gameMap.IsQueenSurrounded((attackerId + 1) % 2)) {
+		return true;
+	}
+	if (plies <= 0) {
+		return false;
+	}
+
+	int opponentId = (IDOfPlayer + 1) % 2;
+	bool isAttacker = IDOfPlayer == attackerId;
+	auto moves = GenerateReferenceMoves(gameMap, IDOfPlayer);
+	if (moves.empty()) {
+		if (GenerateReferenceMoves(gameMap, opponentId).empty()) {
+			return false;
+		}
+		return CanSurround(gameMap, attackerId, opponentId, plies - 1);
+	}
+	for (const auto& move : moves) {
+		gameMap.MakeMove(move);
+		bool isWon = CanSurround(gameMap, attackerId, opponentId, plies - 1);
+		gameMap.UndoMove(move);
+		// Attacker needs one winning move, defender one saving move
+		if (isWon == isAttacker) {
+			return isWon;
+		}
+	}
+	return !isAttacker;
+}
+
+void CheckSurroundSolver() {
+	std::cout << "SurroundSolver agrees with the brute force" << std::endl;
+	std::mt19937 random(RANDOM_SEED);
+	SurroundSolver solver;
+	int positionsCount = 0;
+	std::vector<int> provenCounts(BRUTE_FORCE_MAX_PLIES + 1, 0);
+
+	PlayRandomGames(
+	    random,
+	    [&](const HiveBoard& gameMap, int IDOfPlayer, const std::vector<Move>&) {
+		    // Surrounds within few plies are common only next to crowded Queen
+		    auto defendingQueen = MakePieceId((IDOfPlayer + 1) % 2, 0, 0);
+		    if (positionsCount == SOLVER_POSITIONS_COUNT || !gameMap.IsPieceOnBoard(defendingQueen)) {
+			    return;
+		    }
+		    auto defendingQueenCords = gameMap.GetPositionOfPiece(defendingQueen);
+		    if (gameMap.GetOccupiedNeighborsCount(defendingQueenCords) < CROWDED_QUEEN_NEIGHBORS) {
+			    return;
+		    }
+		    positionsCount++;
+		    HiveBoard board = gameMap;
+		    for (int plies = 1; plies <= BRUTE_FORCE_MAX_PLIES; plies += 2) {
+			    auto position = " in position " + std::to_string(positionsCount) + " at " + std::to_string(plies) +
+			                    " plies";
+			    bool isProven = solver.Solve(gameMap, IDOfPlayer, plies) == SurroundSolver::Result::PROVEN;
+			    Check(isProven == CanSurround(board, IDOfPlayer, IDOfPlayer, plies), "solver disagrees" + position);
+			    if (!isProven) {
+				    continue;
+			    }
+			    provenCounts[plies]++;
+			    // Pass is the best move only when the attacker can't move
+			    const auto& move = solver.GetBestMove();
+			    if (move.piece == NO_PIECE) {
+				    Check(GenerateReferenceMoves(board, IDOfPlayer).empty(), "solver passes with moves" + position);
+				    continue;
+			    }
+			    board.MakeMove(move);
+			    Check(CanSurround(board, IDOfPlayer, (IDOfPlayer + 1) % 2, plies - 1),
+			          "best move of the solver doesn't win" + position);
+			    board.UndoMove(move);
+		    }
+	    },
+	    [](const HiveBoard&, const Move&) {});
+
+	std::cout << "    " << positionsCount << " positions";
+	for (int plies = 1; plies <= BRUTE_FORCE_MAX_PLIES; plies += 2) {
+		std::cout << ", " << provenCounts[plies] << " proven in " << plies << " plies";
+		Check(provenCounts[plies] > 0, "no position was proven in " + std::to_string(plies) + " plies");
+	}
+	std::cout << std::endl;
+	Check(provenCounts[BRUTE_FORCE_MAX_PLIES] < positionsCount, "every position was proven, nothing was disproven");
+}
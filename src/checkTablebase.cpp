@@ -0,0 +1,192 @@
+#include "checkEngine.h"
+#include "common.h"
+#include "hexUtilities.h"
+#include "HiveBoard.h"
+#include "SurroundSolver.h"
+#include "Tablebase.h"
+#include "TablebaseGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static constexpr int TABLEBASE_POSITIONS_COUNT = 300; /**< Number of positions probed in the tablebase check. */
+static constexpr int TERMINAL_POSITIONS_COUNT = 20;   /**< Number of positions with surrounded Queen of each player. */
+static constexpr int SOLVER_MAX_PLIES = 9;            /**< Depth of the solver compared with the tablebase. */
+
+/**
+ * @brief Builds random connected position of the pieces, where one Queen has atleast four neighbors and none of the
+ * Queens is surrounded.
+ *
+ * Most random positions are decided far beyond the depth of the solver, nearly surrounded Queen makes short surrounds
+ * common.
+ *
+ * @param pieces The pieces on the board, the first one is placed at (0, 0).
+ * @param crowdedPlayerId The ID of the player, whose Queen has atleast four neighbors.
+ * @param random The random generator.
+ * @return The position with empty hands.
+ */
+static HiveBoard MakeRandomPosition(const std::vector<pieceId>& pieces, int crowdedPlayerId, std::mt19937& random) {
+	const auto crowdedQueen = MakePieceId(crowdedPlayerId, 0, 0);
+	while (true) {
+		HiveBoard gameMap;
+		gameMap.PlacePiece(pieces[0], { 0, 0 });
+		for (size_t i = 1; i < pieces.size(); i++) {
+			std::vector<HexCords> border;
+			gameMap.ForEachSpaceIn(gameMap.GetBorderOfHive(),
+			                       [&border](const HexCords& cords) { border.push_back(cords); });
+			gameMap.PlacePiece(pieces[i], border[random() % border.size()]);
+		}
+		gameMap.ClearHands();
+		auto crowdedQueenCords = gameMap.GetPositionOfPiece(crowdedQueen);
+		if (!IsGameOver(gameMap) && gameMap.GetOccupiedNeighborsCount(crowdedQueenCords) >= 4) {
+			return gameMap;
+		}
+	}
+}
+
+/**
+ * @brief Get the result the table must give to the position by the results of its children.
+ *
+ * Position is won if some move leads to position lost by the opponent, lost if every move leads to position won by the
+ * opponent and drawn otherwise. Player without any move passes, position where nobody can move is drawn.
+ *
+ * @param tablebase The tablebase.
+ * @param gameMap The game board, that isn't decided by a surrounded Queen. It is restored before returning.
+ * @param IDOfPlayer The ID of the player on turn.
+ * @return The result for the player on turn.
+ */
+static Tablebase::Result GetResultByChildren(const Tablebase& tablebase, HiveBoard& gameMap, int IDOfPlayer) {
+	int opponentId = (IDOfPlayer + 1) % 2;
+	auto moves = GenerateReferenceMoves(gameMap, IDOfPlayer);
+	if (moves.empty()) {
+		if (GenerateReferenceMoves(gameMap, opponentId).empty()) {
+			return Tablebase::Result::DRAW;
+		}
+		// Pass is the only move
+		moves.push_back(Move());
+	}
+
+	bool areAllChildrenWon = true;
+	for (const auto& move : moves) {
+		if (move.piece != NO_PIECE) {
+			gameMap.MakeMove(move);
+		}
+		Tablebase::Result childResult = Tablebase::Result::DRAW;
+		tablebase.Probe(gameMap, opponentId, childResult);
+		if (move.piece != NO_PIECE) {
+			gameMap.UndoMove(move);
+		}
+		if (childResult == Tablebase::Result::LOSS) {
+			return Tablebase::Result::WIN;
+		}
+		areAllChildrenWon &= childResult == Tablebase::Result::WIN;
+	}
+	return areAllChildrenWon ? Tablebase::Result::LOSS : Tablebase::Result::DRAW;
+}
+
+/**
+ * @brief Checks that positions with surrounded Queen are lost for its player and won for the opponent in the table.
+ *
+ * The surrounded Queen lies at (0, 0) and all other pieces form the ring around it in random order, so the other Queen
+ * is never surrounded.
+ *
+ * @param tablebase The tablebase.
+ * @param pieces All pieces of the material.
+ * @param random The random generator.
+ */
+static void CheckTerminalPositions(const Tablebase& tablebase, const std::vector<pieceId>& pieces,
+                                   std::mt19937& random) {
+	for (int surroundedId = 0; surroundedId < 2; surroundedId++) {
+		auto surroundedQueen = MakePieceId(surroundedId, 0, 0);
+		std::vector<pieceId> ring;
+		std::copy_if(pieces.begin(), pieces.end(), std::back_inserter(ring),
+		             [surroundedQueen](pieceId piece) { return piece != surroundedQueen; });
+		if (ring.size() != SIZE_OF_AXIAL_VECTORS) {
+			throw std::runtime_error("Material of the tablebase check doesn't surround a Queen by itself");
+		}
+
+		const auto neighbors = GetNeighborsOfTile({ 0, 0 });
+		for (int i = 0; i < TERMINAL_POSITIONS_COUNT; i++) {
+			std::shuffle(ring.begin(), ring.end(), random);
+			HiveBoard gameMap;
+			gameMap.PlacePiece(surroundedQueen, { 0, 0 });
+			for (int j = 0; j < SIZE_OF_AXIAL_VECTORS; j++) {
+				gameMap.PlacePiece(ring[j], neighbors[j]);
+			}
+			gameMap.ClearHands();
+
+			auto position = " with surrounded Queen of player " + std::to_string(surroundedId);
+			for (int IDOfPlayer = 0; IDOfPlayer < 2; IDOfPlayer++) {
+				auto expected = IDOfPlayer == surroundedId ? Tablebase::Result::LOSS : Tablebase::Result::WIN;
+				Tablebase::Result result;
+				Check(tablebase.Probe(gameMap, IDOfPlayer, result) && result == expected,
+				      "wrong result for player " + std::to_string(IDOfPlayer) + " on turn" + position);
+			}
+		}
+	}
+}
+
+void CheckTablebase() {
+	std::cout << "Tablebase agrees with SurroundSolver and with itself" << std::endl;
+	// Queen needs six neighbors, so five pieces besides both Queens are the least material with any win, Grasshoppers
+	// keep the generation around a minute on one thread
+	std::vector<pieceId> extraPieces = { MakePieceId(0, 3, 0), MakePieceId(0, 3, 1), MakePieceId(0, 3, 2),
+		                                 MakePieceId(1, 3, 0), MakePieceId(1, 3, 1) };
+	TablebaseGenerator generator(extraPieces);
+	generator.Generate();
+	auto fileName = std::string("hive_check") + TABLEBASE_FILE_EXTENSION;
+	auto path = (std::filesystem::temp_directory_path() / fileName).string();
+	generator.Save(path);
+
+	std::array<int, 4> resultsCount = {};
+	int provenCount = 0;
+	int unprovenWinsCount = 0;
+	{
+		// Table is unmapped at the end of the scope, before its file is removed
+		Tablebase tablebase;
+		tablebase.Load(path);
+		std::vector<pieceId> pieces = extraPieces;
+		pieces.insert(pieces.begin(), { MakePieceId(0, 0, 0), MakePieceId(1, 0, 0) });
+
+		std::mt19937 random(RANDOM_SEED);
+		CheckTerminalPositions(tablebase, pieces, random);
+
+		SurroundSolver solver;
+		for (int i = 0; i < TABLEBASE_POSITIONS_COUNT; i++) {
+			auto gameMap = MakeRandomPosition(pieces, (int)(random() % 2), random);
+			int IDOfPlayer = (int)(random() % 2);
+			auto position = " position " + std::to_string(i);
+			Tablebase::Result result;
+			if (!Check(tablebase.Probe(gameMap, IDOfPlayer, result), "table of" + position + " not found")) {
+				continue;
+			}
+			resultsCount[(int)result]++;
+			Check(result == GetResultByChildren(tablebase, gameMap, IDOfPlayer),
+			      "result of" + position + " doesn't follow from its children");
+
+			// Solver proves only surrounds within SOLVER_MAX_PLIES, table doesn't know the length of the win
+			auto solverResult = solver.Solve(gameMap, IDOfPlayer, SOLVER_MAX_PLIES);
+			if (solverResult == SurroundSolver::Result::PROVEN) {
+				provenCount++;
+				Check(result != Tablebase::Result::LOSS, "proven" + position + " is lost in table");
+				Check(result != Tablebase::Result::DRAW, "proven" + position + " is drawn in table");
+			} else if (result == Tablebase::Result::WIN) {
+				unprovenWinsCount++;
+			}
+		}
+	}
+	std::filesystem::remove(path);
+	std::cout << "    " << TABLEBASE_POSITIONS_COUNT << " positions, "
+	          << resultsCount[(int)Tablebase::Result::WIN] << " won, " << resultsCount[(int)Tablebase::Result::DRAW]
+	          << " drawn, " << resultsCount[(int)Tablebase::Result::LOSS] << " lost, " << provenCount << " proven, "
+	          << unprovenWinsCount << " won in table but longer than " << SOLVER_MAX_PLIES << " plies" << std::endl;
+	Check(provenCount > 0, "no position was proven, the check compared nothing");
+	Check(resultsCount[(int)Tablebase::Result::LOSS] > 0, "no position was lost, losses weren't checked");
+}
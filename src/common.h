@@ -15,7 +15,9 @@
 #include "raymath.h"
 #include "rlgl.h"
 
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -26,14 +28,22 @@
 // Defaults constants
 constexpr int HEXAGON_SIDES_COUNT = 6;   /**< Number of sides in a hexagon. */
 constexpr int SIZE_OF_AXIAL_VECTORS = 6; /**< Size of axial vectors array. */
-constexpr bool DEBUG_MODE = false;       /**< Turns on unlimeted FPS and frame time */
 
 // Screen constants
-constexpr int FPS = 90; /**< Frames per second for the game. (Only if DEBUG_MODE == false */
+constexpr int FPS = 90; /**< Frames per second for the game. (Only if the frame profiler is off) */
 
 // GameEngine constants
 constexpr int HEXAGON_VERTICAL_COUNT = 12; /**< Number of hexagons vertically in the game board. */
 constexpr int DIFFERENT_PIECES_COUNT = 5;
+constexpr int PIECES_PER_PLAYER = 11;               /**< Number of pieces every player starts with. */
+constexpr int PIECES_COUNT = PIECES_PER_PLAYER * 2; /**< Number of pieces in the whole game. */
+
+/**
+ * @typedef pieceId
+ * @brief Dense identifier (0-21) of a single bug piece. It encodes owner, bug type and ordinal of the piece.
+ */
+using pieceId = std::uint8_t;
+constexpr pieceId NO_PIECE = std::numeric_limits<pieceId>::max(); /**< Marks empty space on the game map. */
 
 // Renderer constants
 constexpr float WINDOW_SCALING = (float)(2 / 3.0);     /**< Scaling factor for window size. */
@@ -41,6 +51,13 @@ const float SQRT_OF_THREE = (float)sqrt(3);            /**< Square root of three
 constexpr float SIDE_SIZE_PERCENT = (float)(1.4 / 10); /**< Side size percentage. */
 constexpr float TOLERANCE = 5;                         /**< Tolerance value for calculations. */
 constexpr int FONT_SIZE = 20;                          /**< Default font size. */
+constexpr int MIN_WINDOW_WIDTH = 640;                  /**< Smallest width the window can be resized to. */
+constexpr int MIN_WINDOW_HEIGHT = 360;                 /**< Smallest height the window can be resized to. */
+constexpr float MIN_ZOOM = 0.05f;                      /**< Smallest zoom of the camera. */
+constexpr float MAX_ZOOM = 4;                          /**< Largest zoom of the camera. */
+constexpr float ZOOM_STEP = 0.1f;                      /**< Relative change of zoom for one step of mouse wheel. */
+constexpr float FLAT_DETAIL_HEX_SIZE = 12;             /**< Smaller hexagons on screen lose outlines and spaces. */
+constexpr float POINTS_DETAIL_HEX_SIZE = 4;            /**< Smaller hexagons on screen are drawn as single points. */
 
 constexpr Color QUEEN_BEE_COLOR = ORANGE;       /**< Color of the Queen Bee. */
 constexpr Color BEETLE_COLOR = PURPLE;          /**< Color of the Beetle. */
@@ -60,6 +77,16 @@ constexpr Color POSSIBLE_MOVES_HIGHLIGHT_COLOR = { 7, 140, 140,
 constexpr std::pair<Color, Color> FIRST_PLAYER_COLORS = { WHITE, BLACK }; /**< Colors for the first player. */
 constexpr std::pair<Color, Color> SECOND_PLAYER_COLORS = { WHITE, GRAY }; /**< Colors for the second player. */
 
+static constexpr const char* TABLEBASES_DIRECTORY =
+    "tablebases"; /**< Directory the tablebase generator writes endgame tables to by default. */
+static constexpr const char* TABLEBASE_FILE_EXTENSION = ".htb"; /**< Extension of the endgame table files. */
+
+static constexpr const char* FRAME_PROFILE_FILE =
+    "frame_profile.csv"; /**< File the frame profiler exports the measured frames to. */
+
+static constexpr const char* TRACE_FILE =
+    "hive_trace.json"; /**< File the recorded spans are written to, if the tracing is compiled in. */
+
 static constexpr const char* QUEEN_MESSAGE =
     "!!! You must place Queen on this turn !!!"; /**< Message indicating that the Queen must be placed. */
 static constexpr const char* DRAW_MESSAGE = "!!! Game ended in draw !!!"; /**< Message indicating a draw. */
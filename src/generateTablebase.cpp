@@ -0,0 +1,101 @@
+#include "common.h"
+#include "Tablebase.h"
+#include "TablebaseGenerator.h"
+#include "Trace.h"
+
+#include <array>
+#include <cctype>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Get the index of the bug type in the player field from its letter.
+ *
+ * @param letter Uppercase first letter of the bug: B(eetle), S(pider), G(rasshopper) or A(nt).
+ * @return Index into STARTING_PIECES or -1 for unknown letter.
+ */
+static int GetHandIndexOfLetter(char letter) {
+	switch (letter) {
+		case 'S':
+			return 1;
+		case 'B':
+			return 2;
+		case 'G':
+			return 3;
+		case 'A':
+			return 4;
+	}
+	return -1;
+}
+
+/**
+ * @brief Parses the pieces besides both Queens.
+ *
+ * @param material Letters of the pieces, uppercase for the first player and lowercase for the second player.
+ * @return The ids of the pieces, pieces of the same kind get increasing ordinals.
+ * @throws std::runtime_error If some letter is unknown or some player doesn't have so many pieces.
+ */
+static std::vector<pieceId> ParseMaterial(const std::string& material) {
+	std::vector<pieceId> pieces;
+	std::array<std::array<int, DIFFERENT_PIECES_COUNT>, 2> usedCount = {};
+	for (char letter : material) {
+		int player = std::isupper((unsigned char)letter) ? 0 : 1;
+		int handIndex = GetHandIndexOfLetter((char)std::toupper((unsigned char)letter));
+		if (handIndex == -1 || usedCount[player][handIndex] == STARTING_PIECES[handIndex].second) {
+			throw std::runtime_error(std::string("Invalid piece ") + letter + " of tablebase material " + material);
+		}
+		pieces.push_back(MakePieceId(player, handIndex, usedCount[player][handIndex]++));
+	}
+	return pieces;
+}
+
+/**
+ * @brief Get the default file name of the table, uppercase letters of both players split by underscore.
+ *
+ * @param material Letters of the pieces besides both Queens.
+ * @return The path inside of TABLEBASES_DIRECTORY.
+ */
+static std::string GetDefaultPath(const std::string& material) {
+	std::array<std::string, 2> names = { "Q", "Q" };
+	for (char letter : material) {
+		names[std::isupper((unsigned char)letter) ? 0 : 1] += (char)std::toupper((unsigned char)letter);
+	}
+	return (std::filesystem::path(TABLEBASES_DIRECTORY) / (names[0] + "_" + names[1] + TABLEBASE_FILE_EXTENSION)).string();
+}
+
+//------------------------------------------------------------------------------------
+// Tablebase generator entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+	if (argc < 2 || argc > 4) {
+		std::cout << "Usage: " << argv[0] << " <pieces> [output file] [threads count]" << std::endl
+		          << "Pieces besides both Queens: B, S, G, A for the first player, b, s, g, a for the second player."
+		          << std::endl;
+		return 1;
+	}
+
+	try {
+		std::string material = argv[1];
+		std::string path = argc >= 3 ? argv[2] : GetDefaultPath(material);
+		TablebaseGenerator generator = argc >= 4 ? TablebaseGenerator(ParseMaterial(material), std::stoi(argv[3]))
+		                                         : TablebaseGenerator(ParseMaterial(material));
+		generator.Generate();
+		std::cout << generator.GetNodesCount() << " positions, "
+		          << generator.GetResultsCount(Tablebase::Result::WIN) << " won, "
+		          << generator.GetResultsCount(Tablebase::Result::DRAW) << " drawn, "
+		          << generator.GetResultsCount(Tablebase::Result::LOSS) << " lost" << std::endl;
+
+		if (std::filesystem::path(path).has_parent_path()) {
+			std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+		}
+		generator.Save(path);
+		TRACE_FLUSH(TRACE_FILE);
+	} catch (const std::exception& e) {
+		std::cout << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
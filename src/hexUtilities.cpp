@@ -5,54 +5,6 @@
 
 #include <iostream>
 
-bool HexCords::operator<(const HexCords& other) const {
-	return this->q < other.q || (this->q == other.q && this->r < other.r);
-}
-
-HexCords HexCords::operator+(const HexCords& other) const { return { this->q + other.q, this->r + other.r }; }
-
-HexCords HexCords::operator+=(const HexCords& other) {
-	this->q += other.q;
-	this->r += other.r;
-	return *this;
-}
-
-possibleMovesSet GetNeighborsOfTile(const hexTileMap& gameMap, const HexCords& tile) {
-	possibleMovesSet result;
-	HexCords tempHexCord = { std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
-	for (int i = 0; i < SIZE_OF_AXIAL_VECTORS; i++) {
-		tempHexCord = tile + AXIAL_DIRECTION_VECTORS[i];
-		result.insert(tempHexCord);
-	}
-	return result;
-}
-
-possibleMovesSet GetEmptyNeighborsOfTile(const hexTileMap& gameMap, const HexCords& tile) {
-	auto neighbors = GetNeighborsOfTile(gameMap, tile);
-	possibleMovesSet result;
-	for (const auto& x : neighbors) {
-		auto it = gameMap.find(x);
-		if (it != gameMap.end() && it->second == nullptr) {
-			result.insert(x);
-		}
-	}
-
-	return result;
-}
-
-possibleMovesSet GetOccupiedNeighborsOfTile(const hexTileMap& gameMap, const HexCords& tile) {
-	auto neighbors = GetNeighborsOfTile(gameMap, tile);
-	possibleMovesSet result;
-	for (const auto& x : neighbors) {
-		auto it = gameMap.find(x);
-		if (it != gameMap.end() && it->second != nullptr) {
-			result.insert(x);
-		}
-	}
-
-	return result;
-}
-
 Vector3 Cube_round(Vector3 frac) {
 	int q, r, s;
 	q = (int)round(frac.x);
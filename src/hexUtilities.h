@@ -16,8 +16,14 @@
 #include "raymath.h"
 #include "rlgl.h"
 
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <concepts>
 #include <iostream>
 #include <map>
+#include <type_traits>
+#include <utility>
 
 /**
  * @struct HexCords
@@ -33,38 +39,110 @@ struct HexCords {
 	 * @param other The other HexCords object to compare against.
 	 * @return True if this object is less than the other object, false otherwise.
 	 */
-	bool operator<(const HexCords& other) const;
+	constexpr bool operator<(const HexCords& other) const {
+		return this->q < other.q || (this->q == other.q && this->r < other.r);
+	}
+
+	/**
+	 * @brief Equality comparison operator.
+	 * @param other The other HexCords object to compare against.
+	 * @return True if both objects represent the same coordinates.
+	 */
+	bool operator==(const HexCords& other) const = default;
 
 	/**
 	 * @brief Addition operator.
 	 * @param other The other HexCords object to add.
 	 * @return The result of the addition.
 	 */
-	HexCords operator+(const HexCords& other) const;
+	constexpr HexCords operator+(const HexCords& other) const { return { this->q + other.q, this->r + other.r }; }
+
+	/**
+	 * @brief Subtraction operator.
+	 * @param other The other HexCords object to subtract.
+	 * @return The result of the subtraction.
+	 */
+	constexpr HexCords operator-(const HexCords& other) const { return { this->q - other.q, this->r - other.r }; }
 
 	/**
 	 * @brief Compound addition operator.
 	 * @param other The other HexCords object to add.
 	 * @return Reference to the modified HexCords object.
 	 */
-	HexCords operator+=(const HexCords& other);
+	constexpr HexCords operator+=(const HexCords& other) {
+		this->q += other.q;
+		this->r += other.r;
+		return *this;
+	}
 };
 
 // Type Aliases
-class BaseBugTile;
-
-/**
- * @typedef hexTileMap
- * @brief A map of HexCords to shared pointers to BaseBugTile.
- */
-using hexTileMap = std::map<HexCords, std::shared_ptr<BaseBugTile>>;
-
 /**
  * @typedef possibleMovesSet
  * @brief A set of HexCords representing possible moves.
  */
 using possibleMovesSet = std::set<HexCords>;
 
+/**
+ * @brief Set of coordinates with fixed capacity, stored inline without any allocation.
+ *
+ * Sets of the rule functions hold few tens of spaces at most, so linear search over the array is cheaper than tree or
+ * hash set. Coordinates are kept in the order of insertion, so the set also serves as the queue of the searches.
+ *
+ * @tparam CAPACITY Maximal number of coordinates in the set.
+ */
+template <std::size_t CAPACITY>
+class FixedCordsSet {
+public:
+	/**
+	 * @brief Checks if the coordinates are in the set.
+	 *
+	 * @param cords The coordinates.
+	 * @return True if the coordinates are in the set, false otherwise.
+	 */
+	constexpr bool Contains(const HexCords& cords) const {
+		for (std::size_t i = 0; i < size; i++) {
+			if (items[i] == cords) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Adds the coordinates to the end of the set, if they aren't in it yet.
+	 *
+	 * @param cords The coordinates.
+	 * @return True if the coordinates were added, false if they already were in the set.
+	 */
+	constexpr bool Insert(const HexCords& cords) {
+		if (Contains(cords)) {
+			return false;
+		}
+		items[size++] = cords;
+		return true;
+	}
+
+	/**
+	 * @brief Get the number of coordinates in the set.
+	 *
+	 * @return std::size_t
+	 */
+	constexpr std::size_t Size() const { return size; }
+
+	/**
+	 * @brief Get the coordinates in the order of insertion.
+	 *
+	 * @param index The index of the coordinates, must be smaller than Size.
+	 * @return const HexCords&
+	 */
+	constexpr const HexCords& operator[](std::size_t index) const { return items[index]; }
+
+private:
+	std::array<HexCords, CAPACITY> items = {}; /**< The coordinates, only the first size are valid. */
+	std::size_t size = 0;                      /**< Number of the coordinates in the set. */
+};
+
 /**
  * @brief Array of axial direction vectors.
  *
@@ -82,37 +160,152 @@ constexpr HexCords AXIAL_DIRECTION_VECTORS[SIZE_OF_AXIAL_VECTORS] = {
 };
 
 /**
- * @brief Get the neighbors of a tile.
+ * @brief Get the direction opposite to the direction.
  *
- * Retrieves the neighboring tiles of the specified tile.
+ * Directions in AXIAL_DIRECTION_VECTORS are ordered in pairs of opposite directions.
  *
- * @param gameMap The game map represented as a hexTileMap.
- * @param tile The coordinates of the tile for which neighbors are to be retrieved.
- * @return A set of HexCords representing the neighboring tiles of the specified tile.
+ * @param direction Index of the direction in AXIAL_DIRECTION_VECTORS.
+ * @return Index of the opposite direction.
  */
-possibleMovesSet GetNeighborsOfTile(const hexTileMap& gameMap, const HexCords& tile);
+constexpr int GetOppositeDirection(int direction) { return direction ^ 1; }
 
 /**
- * @brief Get the emty neighbors of a tile.
+ * @brief Requirements on the board representation used by the rule functions.
  *
- * Retrieves the neighboring tiles of the specified tile, that don't have any Bug piece on them.
+ * Every board must provide free functions GetPieceAt (id of the piece on top of the space or NO_PIECE), IsOnMap,
+ * GetOccupiedTilesCount (number of occupied spaces) and ForEachOccupiedTile, see HexGrid.h. Rule functions are
+ * templated on the board, so the same code works for every board.
+ */
+template <typename Board>
+concept HexBoard = requires(const Board& board, const HexCords& cords) {
+	{ GetPieceAt(board, cords) } -> std::convertible_to<pieceId>;
+	{ IsOnMap(board, cords) } -> std::convertible_to<bool>;
+	{ GetOccupiedTilesCount(board) } -> std::convertible_to<int>;
+	ForEachOccupiedTile(board, [](const HexCords&, pieceId) {});
+};
+
+/**
+ * @typedef neighborsMask
+ * @brief 6-bit mask of neighbors of a tile, bit i corresponds to the direction AXIAL_DIRECTION_VECTORS[i].
+ */
+using neighborsMask = std::uint8_t;
+
+constexpr neighborsMask ALL_NEIGHBORS_MASK = (1 << SIZE_OF_AXIAL_VECTORS) - 1; /**< Mask with all neighbors. */
+
+/**
+ * @brief Get the neighbors of a tile.
  *
- * @param gameMap The game map represented as a hexTileMap.
  * @param tile The coordinates of the tile for which neighbors are to be retrieved.
- * @return A set of HexCords representing the empty neighboring tiles of the specified tile.
+ * @return Array of the neighboring tiles in order of AXIAL_DIRECTION_VECTORS.
+ */
+constexpr std::array<HexCords, SIZE_OF_AXIAL_VECTORS> GetNeighborsOfTile(const HexCords& tile) {
+	std::array<HexCords, SIZE_OF_AXIAL_VECTORS> result = {};
+	for (int i = 0; i < SIZE_OF_AXIAL_VECTORS; i++) {
+		result[i] = tile + AXIAL_DIRECTION_VECTORS[i];
+	}
+	return result;
+}
+
+/**
+ * @brief Get the distance of two tiles.
+ *
+ * @param first The coordinates of the first tile.
+ * @param second The coordinates of the second tile.
+ * @return The number of steps between the tiles.
  */
-possibleMovesSet GetEmptyNeighborsOfTile(const hexTileMap& gameMap, const HexCords& tile);
+constexpr int GetDistance(const HexCords& first, const HexCords& second) {
+	auto difference = first - second;
+	auto absolute = [](int value) { return value < 0 ? -value : value; };
+	return (absolute(difference.q) + absolute(difference.r) + absolute(difference.q + difference.r)) / 2;
+}
 
 /**
- * @brief Get the occupied neighbors of a tile.
+ * @brief Calls the visitor and checks if the iteration should stop.
  *
- * Retrieves the neighboring tiles of the specified tile, that have Bug piece on them.
+ * Visitors returning bool stop the iteration by returning true, other visitors never stop it.
  *
- * @param gameMap The game map represented as a hexTileMap.
- * @param tile The coordinates of the tile for which neighbors are to be retrieved.
- * @return A set of HexCords representing the occupied neighboring tiles of the specified tile.
+ * @param function The visitor.
+ * @param args Arguments passed to the visitor.
+ * @return True if the iteration should stop, false otherwise.
+ */
+template <typename Function, typename... Args>
+constexpr bool CallAndCheckStop(Function& function, Args&&... args) {
+	if constexpr (std::is_same_v<std::invoke_result_t<Function&, Args...>, bool>) {
+		return function(std::forward<Args>(args)...);
+	} else {
+		function(std::forward<Args>(args)...);
+		return false;
+	}
+}
+
+/**
+ * @brief Calls function for every neighbor of a tile that is present in the mask.
+ *
+ * @param tile The coordinates of the tile.
+ * @param mask The mask of neighbors to visit.
+ * @param function Callable taking coordinates of the neighbor, it can stop the iteration by returning true.
+ * @return True if the function stopped the iteration, false otherwise.
+ */
+template <typename Function>
+constexpr bool ForEachNeighborInMask(const HexCords& tile, neighborsMask mask, Function&& function) {
+	for (; mask != 0; mask &= mask - 1) {
+		if (CallAndCheckStop(function, tile + AXIAL_DIRECTION_VECTORS[std::countr_zero(mask)])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Get the mask of occupied neighbors of a tile.
+ *
+ * Boards, that keep masks of their spaces, provide cheaper non-template overload.
+ *
+ * @param gameMap The game map.
+ * @param tile The coordinates of the tile.
+ * @return Mask with bits set for neighbors, that have Bug piece on them.
+ */
+template <HexBoard Board>
+neighborsMask GetOccupiedNeighborsMask(const Board& gameMap, const HexCords& tile) {
+	neighborsMask result = 0;
+	for (int i = 0; i < SIZE_OF_AXIAL_VECTORS; i++) {
+		if (GetPieceAt(gameMap, tile + AXIAL_DIRECTION_VECTORS[i]) != NO_PIECE) {
+			result |= (neighborsMask)(1 << i);
+		}
+	}
+	return result;
+}
+
+/**
+ * @brief Get the mask of empty neighbors of a tile.
+ *
+ * @param gameMap The game map.
+ * @param tile The coordinates of the tile.
+ * @return Mask with bits set for neighbors, that are on the map and don't have any Bug piece on them.
+ */
+template <HexBoard Board>
+neighborsMask GetEmptyNeighborsMask(const Board& gameMap, const HexCords& tile) {
+	neighborsMask result = 0;
+	for (int i = 0; i < SIZE_OF_AXIAL_VECTORS; i++) {
+		auto neighbor = tile + AXIAL_DIRECTION_VECTORS[i];
+		if (IsOnMap(gameMap, neighbor) && GetPieceAt(gameMap, neighbor) == NO_PIECE) {
+			result |= (neighborsMask)(1 << i);
+		}
+	}
+	return result;
+}
+
+/**
+ * @brief Get the number of occupied neighbors of a tile.
+ *
+ * @param gameMap The game map.
+ * @param tile The coordinates of the tile.
+ * @return Number of neighbors, that have Bug piece on them.
  */
-possibleMovesSet GetOccupiedNeighborsOfTile(const hexTileMap& gameMap, const HexCords& tile);
+template <HexBoard Board>
+int GetOccupiedNeighborsCount(const Board& gameMap, const HexCords& tile) {
+	return std::popcount(GetOccupiedNeighborsMask(gameMap, tile));
+}
 
 /**
  * @brief Rounds the fractional cube coordinates to the nearest cube coordinates.
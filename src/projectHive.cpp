@@ -1,10 +1,13 @@
 #include "common.h"
+#include "FrameProfiler.h"
+#include "FrameScheduler.h"
 #include "GameEngine.h"
 #include "hexUtilities.h"
 #include "raylib.h"
 #include "raymath.h"
 #include "Renderer.h"
 #include "rlgl.h"
+#include "Trace.h"
 
 #include <iostream>
 #include <map>
@@ -18,18 +21,56 @@
 //------------------------------------------------------------------------------------
 int main() {
 	GameEngine gameEngine;
+	FrameScheduler frameScheduler;
+	FrameProfiler& frameProfiler = FrameProfiler::GetDefault();
 
-	// Main game loop
+	// Main game loop, frame is rendered only when something has changed
 	while (!WindowShouldClose()) {
 		try {
-			gameEngine.RenderBaseLayout();
-			gameEngine.CheckInputs();
-			gameEngine.RenderRest();
-			EndDrawing();
+			if (frameProfiler.CheckInputs()) {
+				// Profiler measures continuous frames while it is on
+				if (frameProfiler.IsEnabled()) {
+					frameScheduler.BeginAnimation();
+				} else {
+					frameScheduler.EndAnimation();
+				}
+				frameScheduler.Invalidate();
+			}
+			frameProfiler.BeginFrame();
+#ifdef HIVE_TRACING
+			if (IsKeyPressed(KEY_F5)) {
+				TRACE_FLUSH(TRACE_FILE);
+				std::cout << "Trace written to " << TRACE_FILE << std::endl;
+			}
+#endif
+			if (gameEngine.CheckInputs()) {
+				frameScheduler.Invalidate();
+			}
+			if (frameScheduler.IsFrameNeeded()) {
+				TRACE_SCOPE("Frame");
+				frameScheduler.BeginFrame();
+				BeginDrawing();
+				gameEngine.RenderBaseLayout();
+				gameEngine.RenderRest();
+				frameProfiler.Draw();
+				{
+					TRACE_SCOPE("EndDrawing");
+					FrameProfiler::ScopedTimer timer(FramePhase::END_DRAWING);
+					EndDrawing();
+				}
+				frameProfiler.EndFrame();
+			} else {
+				frameScheduler.WaitForEvents();
+			}
 		} catch (const std::exception& e) {
 			std::cout << e.what() << std::endl;
 		}
 	}
 	CloseWindow();
+	try {
+		TRACE_FLUSH(TRACE_FILE);
+	} catch (const std::exception& e) {
+		std::cout << e.what() << std::endl;
+	}
 	return 0;
 }